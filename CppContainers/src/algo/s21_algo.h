@@ -0,0 +1,614 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+
+// Vectorized scans over contiguous storage (Vector, SmallVector, Array).
+// int32_t and float ranges go through SSE2 or AVX2 kernels picked at run time;
+// every other element type uses the scalar loops. Define S21_ALGO_SIMD to 0 to
+// force the scalar path everywhere.
+#ifndef S21_ALGO_SIMD
+#define S21_ALGO_SIMD 1
+#endif
+
+#if S21_ALGO_SIMD && defined(__x86_64__) && \
+    (defined(__GNUC__) || defined(__clang__))
+#define S21_ALGO_X86 1
+#include <immintrin.h>
+#else
+#define S21_ALGO_X86 0
+#endif
+
+namespace s21::algo {
+
+// Integer sums widen to 64 bits so that summing int32_t never overflows in
+// practice; floating point sums keep the element type
+template <typename T>
+using sum_t = std::conditional_t<
+    std::is_integral_v<T>,
+    std::conditional_t<std::is_signed_v<T>, int64_t, uint64_t>, T>;
+
+namespace detail {
+
+template <typename T>
+inline constexpr bool vectorizable =
+    std::is_same_v<T, int32_t> || std::is_same_v<T, float>;
+
+namespace scalar {
+
+template <typename T>
+size_t find(const T* data, size_t size, const T& value) {
+  for (size_t i = 0; i < size; ++i) {
+    if (data[i] == value) {
+      return i;
+    }
+  }
+  return size;
+}
+
+template <typename T>
+size_t count(const T* data, size_t size, const T& value) {
+  size_t result = 0;
+  for (size_t i = 0; i < size; ++i) {
+    result += data[i] == value;
+  }
+  return result;
+}
+
+template <typename T>
+T min_value(const T* data, size_t size) {
+  T result = data[0];
+  for (size_t i = 1; i < size; ++i) {
+    if (data[i] < result) {
+      result = data[i];
+    }
+  }
+  return result;
+}
+
+template <typename T>
+T max_value(const T* data, size_t size) {
+  T result = data[0];
+  for (size_t i = 1; i < size; ++i) {
+    if (result < data[i]) {
+      result = data[i];
+    }
+  }
+  return result;
+}
+
+template <typename T>
+sum_t<T> sum(const T* data, size_t size) {
+  sum_t<T> result{};
+  for (size_t i = 0; i < size; ++i) {
+    result += data[i];
+  }
+  return result;
+}
+
+template <typename T>
+sum_t<T> dot(const T* lhs, const T* rhs, size_t size) {
+  sum_t<T> result{};
+  for (size_t i = 0; i < size; ++i) {
+    result += sum_t<T>(lhs[i]) * sum_t<T>(rhs[i]);
+  }
+  return result;
+}
+
+}  // namespace scalar
+
+#if S21_ALGO_X86
+
+inline bool has_avx2() noexcept {
+  static const bool supported = __builtin_cpu_supports("avx2");
+  return supported;
+}
+
+// SSE2 is part of the x86-64 baseline, so these kernels need no dispatch
+namespace sse2 {
+
+inline int64_t reduce_add_epi64(__m128i v) noexcept {
+  alignas(16) int64_t lanes[2];
+  _mm_store_si128(reinterpret_cast<__m128i*>(lanes), v);
+  return lanes[0] + lanes[1];
+}
+
+inline float reduce_add_ps(__m128 v) noexcept {
+  alignas(16) float lanes[4];
+  _mm_store_ps(lanes, v);
+  return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+}
+
+// Sign-extends the four int32 lanes and adds them to two int64 lanes
+inline __m128i add_widened_epi32(__m128i acc, __m128i v) noexcept {
+  __m128i sign = _mm_srai_epi32(v, 31);
+  acc = _mm_add_epi64(acc, _mm_unpacklo_epi32(v, sign));
+  return _mm_add_epi64(acc, _mm_unpackhi_epi32(v, sign));
+}
+
+// Signed 32x32->64 multiply of the even lanes. SSE2 only has the unsigned
+// form, so subtract the terms the sign bits contribute to the upper half.
+inline __m128i mul_even_epi32(__m128i a, __m128i b) noexcept {
+  __m128i product = _mm_mul_epu32(a, b);
+  __m128i fix = _mm_add_epi32(_mm_and_si128(_mm_srai_epi32(a, 31), b),
+                              _mm_and_si128(_mm_srai_epi32(b, 31), a));
+  return _mm_sub_epi64(product, _mm_slli_epi64(fix, 32));
+}
+
+inline __m128i min_epi32(__m128i a, __m128i b) noexcept {
+  __m128i greater = _mm_cmpgt_epi32(a, b);
+  return _mm_or_si128(_mm_and_si128(greater, b),
+                      _mm_andnot_si128(greater, a));
+}
+
+inline __m128i max_epi32(__m128i a, __m128i b) noexcept {
+  __m128i greater = _mm_cmpgt_epi32(a, b);
+  return _mm_or_si128(_mm_and_si128(greater, a),
+                      _mm_andnot_si128(greater, b));
+}
+
+inline __m128i load(const int32_t* data) noexcept {
+  return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+}
+
+inline int eq_mask(__m128i v, __m128i needle) noexcept {
+  return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(v, needle)));
+}
+
+inline size_t find(const int32_t* data, size_t size, int32_t value) {
+  __m128i needle = _mm_set1_epi32(value);
+  size_t i = 0;
+  for (; i + 4 <= size; i += 4) {
+    if (int mask = eq_mask(load(data + i), needle)) {
+      return i + __builtin_ctz(mask);
+    }
+  }
+  return i + scalar::find(data + i, size - i, value);
+}
+
+inline size_t find(const float* data, size_t size, float value) {
+  __m128 needle = _mm_set1_ps(value);
+  size_t i = 0;
+  for (; i + 4 <= size; i += 4) {
+    if (int mask = _mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(data + i),
+                                                needle))) {
+      return i + __builtin_ctz(mask);
+    }
+  }
+  return i + scalar::find(data + i, size - i, value);
+}
+
+inline size_t count(const int32_t* data, size_t size, int32_t value) {
+  __m128i needle = _mm_set1_epi32(value);
+  size_t result = 0;
+  size_t i = 0;
+  for (; i + 4 <= size; i += 4) {
+    result += __builtin_popcount(eq_mask(load(data + i), needle));
+  }
+  return result + scalar::count(data + i, size - i, value);
+}
+
+inline size_t count(const float* data, size_t size, float value) {
+  __m128 needle = _mm_set1_ps(value);
+  size_t result = 0;
+  size_t i = 0;
+  for (; i + 4 <= size; i += 4) {
+    result += __builtin_popcount(
+        _mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(data + i), needle)));
+  }
+  return result + scalar::count(data + i, size - i, value);
+}
+
+inline int32_t min_value(const int32_t* data, size_t size) {
+  if (size < 4) {
+    return scalar::min_value(data, size);
+  }
+  __m128i acc = load(data);
+  size_t i = 4;
+  for (; i + 4 <= size; i += 4) {
+    acc = min_epi32(acc, load(data + i));
+  }
+  alignas(16) int32_t lanes[4];
+  _mm_store_si128(reinterpret_cast<__m128i*>(lanes), acc);
+  int32_t result = scalar::min_value(lanes, 4);
+  for (; i < size; ++i) {
+    result = data[i] < result ? data[i] : result;
+  }
+  return result;
+}
+
+inline float min_value(const float* data, size_t size) {
+  if (size < 4) {
+    return scalar::min_value(data, size);
+  }
+  __m128 acc = _mm_loadu_ps(data);
+  size_t i = 4;
+  for (; i + 4 <= size; i += 4) {
+    acc = _mm_min_ps(acc, _mm_loadu_ps(data + i));
+  }
+  alignas(16) float lanes[4];
+  _mm_store_ps(lanes, acc);
+  float result = scalar::min_value(lanes, 4);
+  for (; i < size; ++i) {
+    result = data[i] < result ? data[i] : result;
+  }
+  return result;
+}
+
+inline int32_t max_value(const int32_t* data, size_t size) {
+  if (size < 4) {
+    return scalar::max_value(data, size);
+  }
+  __m128i acc = load(data);
+  size_t i = 4;
+  for (; i + 4 <= size; i += 4) {
+    acc = max_epi32(acc, load(data + i));
+  }
+  alignas(16) int32_t lanes[4];
+  _mm_store_si128(reinterpret_cast<__m128i*>(lanes), acc);
+  int32_t result = scalar::max_value(lanes, 4);
+  for (; i < size; ++i) {
+    result = result < data[i] ? data[i] : result;
+  }
+  return result;
+}
+
+inline float max_value(const float* data, size_t size) {
+  if (size < 4) {
+    return scalar::max_value(data, size);
+  }
+  __m128 acc = _mm_loadu_ps(data);
+  size_t i = 4;
+  for (; i + 4 <= size; i += 4) {
+    acc = _mm_max_ps(acc, _mm_loadu_ps(data + i));
+  }
+  alignas(16) float lanes[4];
+  _mm_store_ps(lanes, acc);
+  float result = scalar::max_value(lanes, 4);
+  for (; i < size; ++i) {
+    result = result < data[i] ? data[i] : result;
+  }
+  return result;
+}
+
+inline int64_t sum(const int32_t* data, size_t size) {
+  __m128i acc = _mm_setzero_si128();
+  size_t i = 0;
+  for (; i + 4 <= size; i += 4) {
+    acc = add_widened_epi32(acc, load(data + i));
+  }
+  return reduce_add_epi64(acc) + scalar::sum(data + i, size - i);
+}
+
+inline float sum(const float* data, size_t size) {
+  __m128 acc = _mm_setzero_ps();
+  size_t i = 0;
+  for (; i + 4 <= size; i += 4) {
+    acc = _mm_add_ps(acc, _mm_loadu_ps(data + i));
+  }
+  return reduce_add_ps(acc) + scalar::sum(data + i, size - i);
+}
+
+inline int64_t dot(const int32_t* lhs, const int32_t* rhs, size_t size) {
+  __m128i acc = _mm_setzero_si128();
+  size_t i = 0;
+  for (; i + 4 <= size; i += 4) {
+    __m128i a = load(lhs + i);
+    __m128i b = load(rhs + i);
+    acc = _mm_add_epi64(acc, mul_even_epi32(a, b));
+    acc = _mm_add_epi64(acc, mul_even_epi32(_mm_srli_epi64(a, 32),
+                                            _mm_srli_epi64(b, 32)));
+  }
+  return reduce_add_epi64(acc) + scalar::dot(lhs + i, rhs + i, size - i);
+}
+
+inline float dot(const float* lhs, const float* rhs, size_t size) {
+  __m128 acc = _mm_setzero_ps();
+  size_t i = 0;
+  for (; i + 4 <= size; i += 4) {
+    acc = _mm_add_ps(acc,
+                     _mm_mul_ps(_mm_loadu_ps(lhs + i), _mm_loadu_ps(rhs + i)));
+  }
+  return reduce_add_ps(acc) + scalar::dot(lhs + i, rhs + i, size - i);
+}
+
+}  // namespace sse2
+
+// Compiled for AVX2 regardless of -march; only called once has_avx2() agrees
+namespace avx2 {
+
+#define S21_ALGO_AVX2 __attribute__((target("avx2")))
+
+S21_ALGO_AVX2 inline __m256i load(const int32_t* data) noexcept {
+  return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+}
+
+S21_ALGO_AVX2 inline int eq_mask(__m256i v, __m256i needle) noexcept {
+  return _mm256_movemask_ps(
+      _mm256_castsi256_ps(_mm256_cmpeq_epi32(v, needle)));
+}
+
+S21_ALGO_AVX2 inline int eq_mask(__m256 v, __m256 needle) noexcept {
+  return _mm256_movemask_ps(_mm256_cmp_ps(v, needle, _CMP_EQ_OQ));
+}
+
+S21_ALGO_AVX2 inline int64_t reduce_add_epi64(__m256i v) noexcept {
+  return sse2::reduce_add_epi64(_mm_add_epi64(
+      _mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1)));
+}
+
+S21_ALGO_AVX2 inline float reduce_add_ps(__m256 v) noexcept {
+  return sse2::reduce_add_ps(
+      _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1)));
+}
+
+S21_ALGO_AVX2 inline size_t find(const int32_t* data, size_t size,
+                                 int32_t value) {
+  __m256i needle = _mm256_set1_epi32(value);
+  size_t i = 0;
+  for (; i + 8 <= size; i += 8) {
+    if (int mask = eq_mask(load(data + i), needle)) {
+      return i + __builtin_ctz(mask);
+    }
+  }
+  return i + sse2::find(data + i, size - i, value);
+}
+
+S21_ALGO_AVX2 inline size_t find(const float* data, size_t size,
+                                 float value) {
+  __m256 needle = _mm256_set1_ps(value);
+  size_t i = 0;
+  for (; i + 8 <= size; i += 8) {
+    if (int mask = eq_mask(_mm256_loadu_ps(data + i), needle)) {
+      return i + __builtin_ctz(mask);
+    }
+  }
+  return i + sse2::find(data + i, size - i, value);
+}
+
+S21_ALGO_AVX2 inline size_t count(const int32_t* data, size_t size,
+                                  int32_t value) {
+  __m256i needle = _mm256_set1_epi32(value);
+  size_t result = 0;
+  size_t i = 0;
+  for (; i + 8 <= size; i += 8) {
+    result += __builtin_popcount(eq_mask(load(data + i), needle));
+  }
+  return result + sse2::count(data + i, size - i, value);
+}
+
+S21_ALGO_AVX2 inline size_t count(const float* data, size_t size,
+                                  float value) {
+  __m256 needle = _mm256_set1_ps(value);
+  size_t result = 0;
+  size_t i = 0;
+  for (; i + 8 <= size; i += 8) {
+    result += __builtin_popcount(eq_mask(_mm256_loadu_ps(data + i), needle));
+  }
+  return result + sse2::count(data + i, size - i, value);
+}
+
+S21_ALGO_AVX2 inline int32_t min_value(const int32_t* data, size_t size) {
+  if (size < 8) {
+    return sse2::min_value(data, size);
+  }
+  __m256i acc = load(data);
+  size_t i = 8;
+  for (; i + 8 <= size; i += 8) {
+    acc = _mm256_min_epi32(acc, load(data + i));
+  }
+  alignas(32) int32_t lanes[8];
+  _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+  int32_t result = scalar::min_value(lanes, 8);
+  for (; i < size; ++i) {
+    result = data[i] < result ? data[i] : result;
+  }
+  return result;
+}
+
+S21_ALGO_AVX2 inline float min_value(const float* data, size_t size) {
+  if (size < 8) {
+    return sse2::min_value(data, size);
+  }
+  __m256 acc = _mm256_loadu_ps(data);
+  size_t i = 8;
+  for (; i + 8 <= size; i += 8) {
+    acc = _mm256_min_ps(acc, _mm256_loadu_ps(data + i));
+  }
+  alignas(32) float lanes[8];
+  _mm256_store_ps(lanes, acc);
+  float result = scalar::min_value(lanes, 8);
+  for (; i < size; ++i) {
+    result = data[i] < result ? data[i] : result;
+  }
+  return result;
+}
+
+S21_ALGO_AVX2 inline int32_t max_value(const int32_t* data, size_t size) {
+  if (size < 8) {
+    return sse2::max_value(data, size);
+  }
+  __m256i acc = load(data);
+  size_t i = 8;
+  for (; i + 8 <= size; i += 8) {
+    acc = _mm256_max_epi32(acc, load(data + i));
+  }
+  alignas(32) int32_t lanes[8];
+  _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+  int32_t result = scalar::max_value(lanes, 8);
+  for (; i < size; ++i) {
+    result = result < data[i] ? data[i] : result;
+  }
+  return result;
+}
+
+S21_ALGO_AVX2 inline float max_value(const float* data, size_t size) {
+  if (size < 8) {
+    return sse2::max_value(data, size);
+  }
+  __m256 acc = _mm256_loadu_ps(data);
+  size_t i = 8;
+  for (; i + 8 <= size; i += 8) {
+    acc = _mm256_max_ps(acc, _mm256_loadu_ps(data + i));
+  }
+  alignas(32) float lanes[8];
+  _mm256_store_ps(lanes, acc);
+  float result = scalar::max_value(lanes, 8);
+  for (; i < size; ++i) {
+    result = result < data[i] ? data[i] : result;
+  }
+  return result;
+}
+
+S21_ALGO_AVX2 inline int64_t sum(const int32_t* data, size_t size) {
+  __m256i acc = _mm256_setzero_si256();
+  size_t i = 0;
+  for (; i + 8 <= size; i += 8) {
+    __m256i v = load(data + i);
+    __m256i sign = _mm256_srai_epi32(v, 31);
+    acc = _mm256_add_epi64(acc, _mm256_unpacklo_epi32(v, sign));
+    acc = _mm256_add_epi64(acc, _mm256_unpackhi_epi32(v, sign));
+  }
+  return reduce_add_epi64(acc) + sse2::sum(data + i, size - i);
+}
+
+S21_ALGO_AVX2 inline float sum(const float* data, size_t size) {
+  __m256 acc = _mm256_setzero_ps();
+  size_t i = 0;
+  for (; i + 8 <= size; i += 8) {
+    acc = _mm256_add_ps(acc, _mm256_loadu_ps(data + i));
+  }
+  return reduce_add_ps(acc) + sse2::sum(data + i, size - i);
+}
+
+S21_ALGO_AVX2 inline int64_t dot(const int32_t* lhs, const int32_t* rhs,
+                                 size_t size) {
+  __m256i acc = _mm256_setzero_si256();
+  size_t i = 0;
+  for (; i + 8 <= size; i += 8) {
+    __m256i a = load(lhs + i);
+    __m256i b = load(rhs + i);
+    acc = _mm256_add_epi64(acc, _mm256_mul_epi32(a, b));
+    acc = _mm256_add_epi64(acc, _mm256_mul_epi32(_mm256_srli_epi64(a, 32),
+                                                 _mm256_srli_epi64(b, 32)));
+  }
+  return reduce_add_epi64(acc) + sse2::dot(lhs + i, rhs + i, size - i);
+}
+
+S21_ALGO_AVX2 inline float dot(const float* lhs, const float* rhs,
+                               size_t size) {
+  __m256 acc = _mm256_setzero_ps();
+  size_t i = 0;
+  for (; i + 8 <= size; i += 8) {
+    acc = _mm256_add_ps(
+        acc, _mm256_mul_ps(_mm256_loadu_ps(lhs + i), _mm256_loadu_ps(rhs + i)));
+  }
+  return reduce_add_ps(acc) + sse2::dot(lhs + i, rhs + i, size - i);
+}
+
+#undef S21_ALGO_AVX2
+
+}  // namespace avx2
+
+#endif  // S21_ALGO_X86
+
+// Picks the widest kernel the CPU runs for int32_t/float, scalar otherwise
+#if S21_ALGO_X86
+#define S21_ALGO_DISPATCH(T, name, ...)       \
+  if constexpr (detail::vectorizable<T>) {    \
+    if (detail::has_avx2()) {                 \
+      return detail::avx2::name(__VA_ARGS__); \
+    }                                         \
+    return detail::sse2::name(__VA_ARGS__);   \
+  }                                           \
+  return detail::scalar::name(__VA_ARGS__)
+#else
+#define S21_ALGO_DISPATCH(T, name, ...) \
+  return detail::scalar::name(__VA_ARGS__)
+#endif
+
+}  // namespace detail
+
+// Index of the first element equal to value, or size if there is none
+template <typename T>
+size_t find(const T* data, size_t size, const T& value) {
+  S21_ALGO_DISPATCH(T, find, data, size, value);
+}
+
+template <typename T>
+size_t count(const T* data, size_t size, const T& value) {
+  S21_ALGO_DISPATCH(T, count, data, size, value);
+}
+
+// The float kernels reduce lane by lane, so a range holding NaN gives an
+// unspecified result
+template <typename T>
+T min_value(const T* data, size_t size) {
+  if (!size) {
+    throw std::out_of_range("Error: min_value of an empty range");
+  }
+  S21_ALGO_DISPATCH(T, min_value, data, size);
+}
+
+template <typename T>
+T max_value(const T* data, size_t size) {
+  if (!size) {
+    throw std::out_of_range("Error: max_value of an empty range");
+  }
+  S21_ALGO_DISPATCH(T, max_value, data, size);
+}
+
+// Float sums are reassociated across lanes and may differ from a sequential
+// loop in the last bits
+template <typename T>
+sum_t<T> sum(const T* data, size_t size) {
+  S21_ALGO_DISPATCH(T, sum, data, size);
+}
+
+template <typename T>
+sum_t<T> dot(const T* lhs, const T* rhs, size_t size) {
+  S21_ALGO_DISPATCH(T, dot, lhs, rhs, size);
+}
+
+#undef S21_ALGO_DISPATCH
+
+// Container overloads for anything exposing data() and size()
+template <typename Container>
+size_t find(const Container& items,
+            const typename Container::value_type& value) {
+  return find(items.data(), items.size(), value);
+}
+
+template <typename Container>
+size_t count(const Container& items,
+             const typename Container::value_type& value) {
+  return count(items.data(), items.size(), value);
+}
+
+template <typename Container>
+typename Container::value_type min_value(const Container& items) {
+  return min_value(items.data(), items.size());
+}
+
+template <typename Container>
+typename Container::value_type max_value(const Container& items) {
+  return max_value(items.data(), items.size());
+}
+
+template <typename Container>
+sum_t<typename Container::value_type> sum(const Container& items) {
+  return sum(items.data(), items.size());
+}
+
+template <typename Container>
+sum_t<typename Container::value_type> dot(const Container& lhs,
+                                          const Container& rhs) {
+  if (lhs.size() != rhs.size()) {
+    throw std::invalid_argument("Error: dot of ranges with different sizes");
+  }
+  return dot(lhs.data(), rhs.data(), lhs.size());
+}
+
+}  // namespace s21::algo
@@ -1,3 +1,9 @@
+#pragma once
+
+#include <algorithm>
+#include <type_traits>
+
+#include "s21_trivial_fill.h"
 #include "s21_vector.h"
 
 namespace s21 {
@@ -26,8 +32,11 @@ class Array {
   reference at(size_type pos) { return s.at(pos); }
   const_reference at(size_type pos) const { return s.at(pos); }
   reference operator[](size_type pos) { return s[pos]; }
+  const_reference operator[](size_type pos) const { return s[pos]; }
   const_reference front() { return s.front(); }
   const_reference back() { return s.back(); }
+  T* data() noexcept { return s.data(); }
+  const T* data() const noexcept { return s.data(); }
 
   iterator begin() { return s.begin(); }
   iterator end() { return s.end(); }
@@ -40,8 +49,10 @@ class Array {
   size_type size() const noexcept { return s.size(); }
   void swap(Array& other) { s.swap(other.s); }
   void fill(const_reference value) {
-    for (size_t i = 0; i < size(); ++i) {
-      s[i] = value;
+    if constexpr (std::is_trivially_copyable_v<T>) {
+      fill_trivial(s.data(), size(), value);
+    } else {
+      std::fill_n(s.data(), size(), value);
     }
   }
 
@@ -0,0 +1,93 @@
+#include <cstdint>
+#include <string>
+
+#include "bench.h"
+#include "s21_algo.h"
+#include "s21_vector.h"
+
+namespace {
+
+constexpr size_t kElements = 1 << 22;
+constexpr int kRepeats = 50;
+
+// Bytes read per call over elapsed time; with ns as the time unit, bytes/ns
+// is exactly GB/s
+void report_gbps(const char* benchmark, const char* container, double ns,
+                 size_t bytes_per_call) {
+  s21::bench::report(benchmark, container, kElements, ns,
+                     size_t(kRepeats) * kElements);
+  s21::bench::report_metric(benchmark, container, kElements, "gb_per_s",
+                            double(bytes_per_call) * kRepeats / ns);
+}
+
+template <typename F>
+void run(const std::string& name, const char* kernel, size_t bytes_per_call,
+         F&& fn) {
+  double ns = s21::bench::measure_ns([&] {
+    for (int i = 0; i < kRepeats; ++i) {
+      s21::bench::do_not_optimize(fn());
+    }
+  });
+  report_gbps(name.c_str(), kernel, ns, bytes_per_call);
+}
+
+// Compares the dispatched kernels with the scalar loops over the same
+// Vector storage
+template <typename T>
+void run_type(const char* type, const s21::Vector<T>& a,
+              const s21::Vector<T>& b) {
+  namespace scalar = s21::algo::detail::scalar;
+  const T* x = a.data();
+  const T* y = b.data();
+  const size_t n = a.size();
+  const size_t bytes = n * sizeof(T);
+  const T missing = T(-1);
+  const std::string suffix = std::string("_") + type;
+
+  run("find" + suffix, "scalar", bytes,
+      [&] { return scalar::find(x, n, missing); });
+  run("find" + suffix, "s21::algo", bytes,
+      [&] { return s21::algo::find(a, missing); });
+  run("count" + suffix, "scalar", bytes,
+      [&] { return scalar::count(x, n, x[0]); });
+  run("count" + suffix, "s21::algo", bytes,
+      [&] { return s21::algo::count(a, x[0]); });
+  run("min" + suffix, "scalar", bytes,
+      [&] { return scalar::min_value(x, n); });
+  run("min" + suffix, "s21::algo", bytes,
+      [&] { return s21::algo::min_value(a); });
+  run("max" + suffix, "scalar", bytes,
+      [&] { return scalar::max_value(x, n); });
+  run("max" + suffix, "s21::algo", bytes,
+      [&] { return s21::algo::max_value(a); });
+  run("sum" + suffix, "scalar", bytes, [&] { return scalar::sum(x, n); });
+  run("sum" + suffix, "s21::algo", bytes, [&] { return s21::algo::sum(a); });
+  run("dot" + suffix, "scalar", 2 * bytes,
+      [&] { return scalar::dot(x, y, n); });
+  run("dot" + suffix, "s21::algo", 2 * bytes,
+      [&] { return s21::algo::dot(a, b); });
+}
+
+}  // namespace
+
+int main() {
+  s21::bench::print_header();
+
+  s21::Vector<int32_t> ints_a;
+  s21::Vector<int32_t> ints_b;
+  s21::Vector<float> floats_a;
+  s21::Vector<float> floats_b;
+  uint32_t seed = 1;
+  for (size_t i = 0; i < kElements; ++i) {
+    seed = seed * 1664525u + 1013904223u;
+    ints_a.push_back(int32_t(seed >> 20));
+    ints_b.push_back(int32_t(seed >> 24));
+    floats_a.push_back(float(seed >> 20) / 4096.0f);
+    floats_b.push_back(float(seed >> 24) / 256.0f);
+  }
+
+  run_type("int32", ints_a, ints_b);
+  run_type("float", floats_a, floats_b);
+
+  return 0;
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+
+namespace s21::bench {
+
+// Keeps the optimizer from discarding a value that is only computed for the
+// benchmark
+template <typename T>
+inline void do_not_optimize(T const& value) {
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+// Runs fn once and returns the elapsed wall time in nanoseconds
+template <typename F>
+double measure_ns(F&& fn) {
+  auto start = std::chrono::steady_clock::now();
+  fn();
+  auto stop = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(stop - start).count();
+}
+
+// One CSV row per measurement: benchmark,container,size,metric,value
+inline void print_header() {
+  std::printf("benchmark,container,size,metric,value\n");
+}
+
+inline void report_metric(const char* benchmark, const char* container,
+                          size_t size, const char* metric, double value) {
+  std::printf("%s,%s,%zu,%s,%.3f\n", benchmark, container, size, metric,
+              value);
+}
+
+inline void report(const char* benchmark, const char* container, size_t size,
+                   double total_ns, size_t ops) {
+  report_metric(benchmark, container, size, "ns_per_op",
+                ops ? total_ns / ops : total_ns);
+}
+
+}  // namespace s21::bench
@@ -0,0 +1,114 @@
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "bench.h"
+#include "../s21_containers.h"
+
+// Multi-threaded throughput of s21::ConcurrentMap against s21::Map behind
+// one mutex. Usage: concurrent_map.bench [ops] (default 2e6 per
+// configuration). Threads split `ops` lookups and insert_or_assign calls
+// on random keys of a prefilled map; map_reads_N does N% lookups, and size
+// is the thread count.
+namespace {
+
+constexpr int kKeys = 1 << 16;
+
+// s21::Map guarded by one mutex, with the same surface as ConcurrentMap
+class LockedMap {
+ public:
+  std::optional<int> find(int key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = map_.find(key);
+    if (it == map_.end()) {
+      return std::nullopt;
+    }
+    return it->second;
+  }
+
+  bool insert_or_assign(int key, int value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return map_.insert_or_assign(key, value).second;
+  }
+
+ private:
+  std::mutex mutex_;
+  s21::Map<int, int> map_;
+};
+
+// Small per-thread generator, so the random numbers don't share state
+struct XorShift {
+  uint64_t state;
+
+  uint32_t next() noexcept {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return uint32_t(state >> 32);
+  }
+};
+
+template <typename Map>
+void run(const char* container, size_t threads, size_t ops,
+         unsigned read_percent) {
+  Map map;
+  for (int key = 0; key < kKeys; key += 2) {
+    map.insert_or_assign(key, key);
+  }
+
+  std::atomic<int64_t> found{0};
+  size_t per_thread = ops / threads;
+  double ns = s21::bench::measure_ns([&] {
+    std::vector<std::thread> workers;
+    for (size_t t = 0; t < threads; ++t) {
+      workers.emplace_back([&, t] {
+        XorShift gen{0x9e3779b97f4a7c15ULL * (t + 1)};
+        int64_t hits = 0;
+        for (size_t i = 0; i < per_thread; ++i) {
+          uint32_t r = gen.next();
+          int key = int(r % kKeys);
+          if ((r >> 16) % 100 < read_percent) {
+            hits += map.find(key).has_value();
+          } else {
+            map.insert_or_assign(key, int(i));
+          }
+        }
+        found += hits;
+      });
+    }
+    for (auto& worker : workers) {
+      worker.join();
+    }
+  });
+  s21::bench::do_not_optimize(found.load());
+
+  char benchmark[32];
+  std::snprintf(benchmark, sizeof(benchmark), "map_reads_%u", read_percent);
+  s21::bench::report(benchmark, container, threads, ns, per_thread * threads);
+  s21::bench::report_metric(benchmark, container, threads, "mops_per_s",
+                            per_thread * threads / ns * 1e3);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  size_t ops = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 2000000;
+
+  s21::bench::print_header();
+  for (unsigned read_percent : {50U, 90U, 99U}) {
+    for (size_t threads = 1; threads <= 64; threads *= 2) {
+      run<LockedMap>("mutex+s21::Map", threads, ops, read_percent);
+      run<s21::ConcurrentMap<int, int, std::hash<int>, 16>>(
+          "s21::ConcurrentMap<16>", threads, ops, read_percent);
+      run<s21::ConcurrentMap<int, int, std::hash<int>, 64>>(
+          "s21::ConcurrentMap<64>", threads, ops, read_percent);
+    }
+  }
+
+  return 0;
+}
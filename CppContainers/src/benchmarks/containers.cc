@@ -0,0 +1,279 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <list>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "bench.h"
+#include "../s21_containers.h"
+
+// Side-by-side throughput of the s21 containers and their std counterparts.
+// Usage: containers.bench [max_size]. Sizes run from 1e3 up to max_size
+// (default 1e7). Rows are CSV on stdout.
+namespace {
+
+// Elements inserted into or erased from the middle of a Vector per run
+constexpr size_t kVectorEdits = 100;
+
+// Small sizes repeat the operation to cover ~1e6 element ops per row, but
+// stop early once a row has spent kBudgetNs, setup included, so the
+// quadratic s21 paths finish
+constexpr double kBudgetNs = 2e8;
+
+size_t repeats(size_t n) { return std::max<size_t>(1, 1000000 / n); }
+
+// Calls round() (which returns the nanoseconds it measured) up to `rounds`
+// times and reports the total against rounds * ops_per_round operations
+template <typename F>
+void run_rounds(const char* benchmark, const char* container, size_t n,
+                size_t rounds, size_t ops_per_round, F&& round) {
+  double ns = 0;
+  double wall_ns = 0;
+  size_t done = 0;
+  while (done < rounds && wall_ns < kBudgetNs) {
+    wall_ns += s21::bench::measure_ns([&] { ns += round(); });
+    ++done;
+  }
+  s21::bench::report(benchmark, container, n, ns, done * ops_per_round);
+}
+
+// Key of a table element: s21::Set stores pairs, std::unordered_set keys
+int key_of(int key) { return key; }
+
+template <typename Pair>
+int key_of(const Pair& element) {
+  return element.first;
+}
+
+std::vector<int> shuffled_keys(size_t n) {
+  std::vector<int> keys(n);
+  for (size_t i = 0; i < n; ++i) {
+    keys[i] = int(i);
+  }
+  std::shuffle(keys.begin(), keys.end(), std::mt19937(42));
+  return keys;
+}
+
+template <typename Vec>
+void vector_ops(const char* container, size_t n) {
+  size_t rounds = repeats(n);
+  run_rounds("vector_push_back", container, n, rounds, n, [&] {
+    return s21::bench::measure_ns([&] {
+      Vec v;
+      for (size_t i = 0; i < n; ++i) {
+        v.push_back(int(i));
+      }
+      s21::bench::do_not_optimize(v.data());
+    });
+  });
+
+  Vec v;
+  for (size_t i = 0; i < n; ++i) {
+    v.push_back(int(i));
+  }
+  run_rounds("vector_iterate", container, n, rounds, n, [&] {
+    int64_t total = 0;
+    double ns = s21::bench::measure_ns([&] {
+      for (int el : v) {
+        total += el;
+      }
+    });
+    s21::bench::do_not_optimize(total);
+    return ns;
+  });
+
+  run_rounds("vector_insert_middle", container, n, 1, kVectorEdits, [&] {
+    return s21::bench::measure_ns([&] {
+      for (size_t i = 0; i < kVectorEdits; ++i) {
+        v.insert(v.begin() + v.size() / 2, int(i));
+      }
+    });
+  });
+
+  run_rounds("vector_erase_middle", container, n, 1, kVectorEdits, [&] {
+    return s21::bench::measure_ns([&] {
+      for (size_t i = 0; i < kVectorEdits; ++i) {
+        v.erase(v.begin() + v.size() / 2);
+      }
+    });
+  });
+}
+
+template <typename List>
+void list_ops(const char* container, size_t n) {
+  size_t rounds = repeats(n);
+  run_rounds("list_push_back", container, n, rounds, n, [&] {
+    return s21::bench::measure_ns([&] {
+      List l;
+      for (size_t i = 0; i < n; ++i) {
+        l.push_back(int(i));
+      }
+      s21::bench::do_not_optimize(l.size());
+    });
+  });
+
+  run_rounds("list_push_front", container, n, rounds, n, [&] {
+    return s21::bench::measure_ns([&] {
+      List l;
+      for (size_t i = 0; i < n; ++i) {
+        l.push_front(int(i));
+      }
+      s21::bench::do_not_optimize(l.size());
+    });
+  });
+
+  List l;
+  for (size_t i = 0; i < n; ++i) {
+    l.push_back(int(i));
+  }
+  run_rounds("list_iterate", container, n, rounds, n, [&] {
+    int64_t total = 0;
+    double ns = s21::bench::measure_ns([&] {
+      for (int el : l) {
+        total += el;
+      }
+    });
+    s21::bench::do_not_optimize(total);
+    return ns;
+  });
+
+  run_rounds("list_splice", container, n, rounds, 1, [&] {
+    List front;
+    List back;
+    for (size_t i = 0; i < n / 2; ++i) {
+      front.push_back(int(i));
+      back.push_back(int(i));
+    }
+    double ns =
+        s21::bench::measure_ns([&] { front.splice(front.begin(), back); });
+    s21::bench::do_not_optimize(front.size());
+    return ns;
+  });
+
+  // Work items handed one by one from a queue to a worker list
+  run_rounds("list_splice_one", container, n, rounds, n, [&] {
+    List queued;
+    List running;
+    for (size_t i = 0; i < n; ++i) {
+      queued.push_back(int(i));
+    }
+    double ns = s21::bench::measure_ns([&] {
+      while (!queued.empty()) {
+        running.splice(running.end(), queued, queued.begin());
+      }
+    });
+    s21::bench::do_not_optimize(running.size());
+    return ns;
+  });
+
+  // Two sorted halves, evens and odds, so the merge interleaves every node
+  run_rounds("list_merge", container, n, rounds, n, [&] {
+    List evens;
+    List odds;
+    for (size_t i = 0; i < n / 2; ++i) {
+      evens.push_back(int(2 * i));
+      odds.push_back(int(2 * i + 1));
+    }
+    double ns = s21::bench::measure_ns([&] { evens.merge(odds); });
+    s21::bench::do_not_optimize(evens.size());
+    return ns;
+  });
+
+  std::vector<int> keys = shuffled_keys(n);
+  run_rounds("list_sort", container, n, rounds, n, [&] {
+    List shuffled;
+    for (int key : keys) {
+      shuffled.push_back(key);
+    }
+    double ns = s21::bench::measure_ns([&] { shuffled.sort(); });
+    s21::bench::do_not_optimize(shuffled.front());
+    return ns;
+  });
+}
+
+// Map and Set share the key workload; Insert adapts the element type
+template <typename Table, typename Insert>
+void table_ops(const char* prefix, const char* container, size_t n,
+               Insert insert) {
+  std::string insert_name = std::string(prefix) + "_insert";
+  std::string find_name = std::string(prefix) + "_find";
+  std::string iterate_name = std::string(prefix) + "_iterate";
+  std::string erase_name = std::string(prefix) + "_erase";
+  std::vector<int> keys = shuffled_keys(n);
+  size_t rounds = repeats(n);
+
+  Table table;
+  run_rounds(insert_name.c_str(), container, n, rounds, n, [&] {
+    table.clear();
+    return s21::bench::measure_ns([&] {
+      for (int key : keys) {
+        insert(table, key);
+      }
+    });
+  });
+
+  run_rounds(find_name.c_str(), container, n, rounds, n, [&] {
+    size_t found = 0;
+    double ns = s21::bench::measure_ns([&] {
+      for (int key : keys) {
+        found += table.find(key) != table.end();
+      }
+    });
+    s21::bench::do_not_optimize(found);
+    return ns;
+  });
+
+  run_rounds(iterate_name.c_str(), container, n, rounds, n, [&] {
+    int64_t total = 0;
+    double ns = s21::bench::measure_ns([&] {
+      for (auto it = table.begin(); it != table.end(); ++it) {
+        total += key_of(*it);
+      }
+    });
+    s21::bench::do_not_optimize(total);
+    return ns;
+  });
+
+  run_rounds(erase_name.c_str(), container, n, rounds, n, [&] {
+    if (table.empty()) {
+      for (int key : keys) {
+        insert(table, key);
+      }
+    }
+    return s21::bench::measure_ns([&] {
+      for (int key : keys) {
+        table.erase(table.find(key));
+      }
+    });
+  });
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  size_t max_size = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+
+  s21::bench::print_header();
+  for (size_t n = 1000; n <= max_size; n *= 10) {
+    vector_ops<s21::Vector<int>>("s21::Vector", n);
+    vector_ops<std::vector<int>>("std::vector", n);
+
+    list_ops<s21::List<int>>("s21::List", n);
+    list_ops<std::list<int>>("std::list", n);
+
+    auto map_insert = [](auto& map, int key) { map.insert({key, key}); };
+    auto set_insert = [](auto& set, int key) { set.insert(key); };
+    table_ops<s21::Map<int, int>>("map", "s21::Map", n, map_insert);
+    table_ops<std::unordered_map<int, int>>("map", "std::unordered_map", n,
+                                            map_insert);
+    table_ops<s21::Set<int>>("set", "s21::Set", n, set_insert);
+    table_ops<std::unordered_set<int>>("set", "std::unordered_set", n,
+                                       set_insert);
+  }
+
+  return 0;
+}
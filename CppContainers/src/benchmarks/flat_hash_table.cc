@@ -0,0 +1,103 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "bench.h"
+#include "../s21_containers.h"
+
+// The chained and open-addressing s21::Map backends against
+// std::unordered_map. Usage: flat_hash_table.bench [max_size] (default 1e7).
+// lookup_hit_heavy asks for keys that are present 90% of the time,
+// lookup_miss_heavy only 10% of the time; erase_reinsert churns a tenth of
+// the keys to show lookups don't degrade after erases.
+namespace {
+
+constexpr size_t kLookups = 1000000;
+
+using ChainedMap = s21::Map<int, int>;
+using FlatMap =
+    s21::Map<int, int, std::hash<int>, s21::flat_hash_table<int, int>>;
+using StdMap = std::unordered_map<int, int>;
+
+template <typename Map>
+bool contains(Map& map, int key) {
+  return map.contains(key);
+}
+
+bool contains(StdMap& map, int key) { return map.count(key); }
+
+// Present keys are 0..n-1; the misses are n..2n-1
+std::vector<int> lookup_keys(size_t n, double hit_ratio) {
+  std::mt19937 gen(7);
+  std::uniform_int_distribution<int> key(0, int(n) - 1);
+  std::bernoulli_distribution hit(hit_ratio);
+  std::vector<int> keys(kLookups);
+  for (int& k : keys) {
+    k = key(gen) + (hit(gen) ? 0 : int(n));
+  }
+  return keys;
+}
+
+template <typename Map>
+void run_lookups(const char* benchmark, const char* container, Map& map,
+                 size_t n, const std::vector<int>& keys) {
+  size_t found = 0;
+  double ns = s21::bench::measure_ns([&] {
+    for (int key : keys) {
+      found += contains(map, key);
+    }
+  });
+  s21::bench::do_not_optimize(found);
+  s21::bench::report(benchmark, container, n, ns, keys.size());
+}
+
+template <typename Map>
+void run_map(const char* container, size_t n) {
+  std::vector<int> keys(n);
+  for (size_t i = 0; i < n; ++i) {
+    keys[i] = int(i);
+  }
+  std::shuffle(keys.begin(), keys.end(), std::mt19937(42));
+
+  Map map;
+  double ns = s21::bench::measure_ns([&] {
+    for (int key : keys) {
+      map.insert({key, key});
+    }
+  });
+  s21::bench::report("insert", container, n, ns, n);
+
+  run_lookups("lookup_hit_heavy", container, map, n, lookup_keys(n, 0.9));
+  run_lookups("lookup_miss_heavy", container, map, n, lookup_keys(n, 0.1));
+
+  size_t churn = std::max<size_t>(1, n / 10);
+  ns = s21::bench::measure_ns([&] {
+    for (size_t i = 0; i < churn; ++i) {
+      map.erase(map.find(keys[i]));
+    }
+    for (size_t i = 0; i < churn; ++i) {
+      map.insert({keys[i], keys[i]});
+    }
+  });
+  s21::bench::report("erase_reinsert", container, n, ns, 2 * churn);
+  run_lookups("lookup_miss_heavy_after_churn", container, map, n,
+              lookup_keys(n, 0.1));
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  size_t max_size = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+
+  s21::bench::print_header();
+  for (size_t n = 1000; n <= max_size; n *= 10) {
+    run_map<ChainedMap>("s21::Map<hash_table>", n);
+    run_map<FlatMap>("s21::Map<flat_hash_table>", n);
+    run_map<StdMap>("std::unordered_map", n);
+  }
+
+  return 0;
+}
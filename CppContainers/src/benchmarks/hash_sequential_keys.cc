@@ -0,0 +1,106 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "bench.h"
+#include "../s21_containers.h"
+
+// Integer keys that std::hash leaves as they are: sequential (0, 1, 2, ...)
+// and strided (multiples of 1024). Usage: hash_sequential_keys.bench
+// [max_size] (default 1e6). ModuloBuckets divides on every lookup and, with
+// its even bucket counts, piles strided keys into one bucket in 1024.
+// PowerOfTwoBuckets takes the top bits of a multiply instead of dividing,
+// and spreads both key patterns evenly.
+namespace {
+
+constexpr size_t kLookups = 1000000;
+constexpr int kStrideShift = 10;
+
+using Key = int64_t;
+using ModuloMap = s21::Map<Key, Key>;
+using PowerOfTwoMap =
+    s21::Map<Key, Key, std::hash<Key>,
+             s21::hash_table<Key, Key, std::hash<Key>, std::equal_to<Key>,
+                             s21::PowerOfTwoBuckets>>;
+using FlatMap =
+    s21::Map<Key, Key, std::hash<Key>, s21::flat_hash_table<Key, Key>>;
+using StdMap = std::unordered_map<Key, Key>;
+
+template <typename Map>
+bool contains(Map& map, Key key) {
+  return map.contains(key);
+}
+
+bool contains(StdMap& map, Key key) { return map.count(key); }
+
+// Key number i of a pattern; numbers n..2n-1 are the misses
+Key make_key(size_t i, int shift) { return Key(i) << shift; }
+
+template <typename Map>
+void run_lookups(const char* benchmark, const char* container, Map& map,
+                 size_t n, const std::vector<Key>& keys) {
+  size_t found = 0;
+  double ns = s21::bench::measure_ns([&] {
+    for (Key key : keys) {
+      found += contains(map, key);
+    }
+  });
+  s21::bench::do_not_optimize(found);
+  s21::bench::report(benchmark, container, n, ns, keys.size());
+}
+
+template <typename Map>
+void run_map(const char* pattern, int shift, const char* container,
+             size_t n) {
+  std::vector<Key> keys(n);
+  for (size_t i = 0; i < n; ++i) {
+    keys[i] = make_key(i, shift);
+  }
+
+  Map map;
+  double ns = s21::bench::measure_ns([&] {
+    for (Key key : keys) {
+      map.insert({key, key});
+    }
+  });
+  std::string benchmark = std::string(pattern) + "_insert";
+  s21::bench::report(benchmark.c_str(), container, n, ns, n);
+
+  std::mt19937 gen(7);
+  std::uniform_int_distribution<size_t> number(0, n - 1);
+  std::vector<Key> hits(kLookups), misses(kLookups);
+  for (size_t i = 0; i < kLookups; ++i) {
+    hits[i] = make_key(number(gen), shift);
+    misses[i] = make_key(n + number(gen), shift);
+  }
+  benchmark = std::string(pattern) + "_find_hit";
+  run_lookups(benchmark.c_str(), container, map, n, hits);
+  benchmark = std::string(pattern) + "_find_miss";
+  run_lookups(benchmark.c_str(), container, map, n, misses);
+}
+
+void run_pattern(const char* pattern, int shift, size_t n) {
+  run_map<ModuloMap>(pattern, shift, "s21::Map<ModuloBuckets>", n);
+  run_map<PowerOfTwoMap>(pattern, shift, "s21::Map<PowerOfTwoBuckets>", n);
+  run_map<FlatMap>(pattern, shift, "s21::Map<flat_hash_table>", n);
+  run_map<StdMap>(pattern, shift, "std::unordered_map", n);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  size_t max_size = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+
+  s21::bench::print_header();
+  for (size_t n = 1000; n <= max_size; n *= 10) {
+    run_pattern("sequential", 0, n);
+    run_pattern("strided", kStrideShift, n);
+  }
+
+  return 0;
+}
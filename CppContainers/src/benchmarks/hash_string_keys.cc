@@ -0,0 +1,108 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "bench.h"
+#include "../s21_containers.h"
+
+// Lookups on long string keys that share a 256-byte prefix, so every key
+// comparison walks most of the string. Usage: hash_string_keys.bench
+// [max_size] (default 1e6). Besides ns_per_op each row reports
+// compares_per_find. Comparing every key in the bucket would cost about
+// 1 + load_factor / 2 compares per hit and load_factor per miss. With
+// cached hash codes it stays near 1 and 0, even at max_load_factor 4.
+namespace {
+
+constexpr size_t kPrefixBytes = 256;
+constexpr size_t kLookups = 200000;
+
+size_t compares = 0;
+
+struct CountedString {
+  friend bool operator==(const CountedString& a, const CountedString& b) {
+    ++compares;
+    return a.str == b.str;
+  }
+
+  std::string str;
+};
+
+struct CountedStringHash {
+  size_t operator()(const CountedString& key) const {
+    return std::hash<std::string>()(key.str);
+  }
+};
+
+CountedString make_key(size_t i) {
+  return {std::string(kPrefixBytes, 'k') + std::to_string(i)};
+}
+
+template <typename Map>
+bool contains(Map& map, const CountedString& key) {
+  return map.contains(key);
+}
+
+bool contains(std::unordered_map<CountedString, int, CountedStringHash>& map,
+              const CountedString& key) {
+  return map.count(key);
+}
+
+template <typename Map>
+void run_lookups(const char* benchmark, const char* container, Map& map,
+                 size_t n, const std::vector<CountedString>& keys) {
+  size_t found = 0;
+  compares = 0;
+  double ns = s21::bench::measure_ns([&] {
+    for (auto& key : keys) {
+      found += contains(map, key);
+    }
+  });
+  s21::bench::do_not_optimize(found);
+  s21::bench::report(benchmark, container, n, ns, keys.size());
+  s21::bench::report_metric(benchmark, container, n, "compares_per_find",
+                            double(compares) / keys.size());
+}
+
+template <typename Map>
+void run_map(const char* container, size_t n, float max_load_factor) {
+  Map map;
+  map.max_load_factor(max_load_factor);
+  for (size_t i = 0; i < n; ++i) {
+    map.insert({make_key(i), int(i)});
+  }
+  s21::bench::report_metric("string_keys", container, n, "load_factor",
+                            map.load_factor());
+
+  std::mt19937 gen(7);
+  std::uniform_int_distribution<size_t> key(0, n - 1);
+  std::vector<CountedString> hits, misses;
+  for (size_t i = 0; i < kLookups; ++i) {
+    hits.push_back(make_key(key(gen)));
+    misses.push_back(make_key(n + key(gen)));
+  }
+  run_lookups("string_find_hit", container, map, n, hits);
+  run_lookups("string_find_miss", container, map, n, misses);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  size_t max_size = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+
+  s21::bench::print_header();
+  for (size_t n = 1000; n <= max_size; n *= 10) {
+    run_map<s21::Map<CountedString, int, CountedStringHash>>("s21::Map", n,
+                                                             1.0f);
+    run_map<s21::Map<CountedString, int, CountedStringHash>>(
+        "s21::Map(max_load_factor=4)", n, 4.0f);
+    run_map<std::unordered_map<CountedString, int, CountedStringHash>>(
+        "std::unordered_map", n, 1.0f);
+  }
+
+  return 0;
+}
@@ -0,0 +1,80 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "bench.h"
+#include "../s21_containers.h"
+
+// Lookup cost of s21::Map against std::unordered_map as the table grows.
+// Usage: hash_table_find.bench [max_size] (default 1e7). With rehashing the
+// ns_per_op of map_find should stay flat from 1e3 to 1e7 keys.
+namespace {
+
+constexpr size_t kLookups = 1000000;
+
+bool contains(s21::Map<int, int>& map, int key) { return map.contains(key); }
+
+bool contains(std::unordered_map<int, int>& map, int key) {
+  return map.count(key);
+}
+
+template <typename Map>
+void run_map(const char* container, size_t n) {
+  std::vector<int> keys(n);
+  for (size_t i = 0; i < n; ++i) {
+    keys[i] = int(i);
+  }
+  std::shuffle(keys.begin(), keys.end(), std::mt19937(42));
+
+  Map map;
+  double ns = s21::bench::measure_ns([&] {
+    for (int key : keys) {
+      map.insert({key, key});
+    }
+  });
+  s21::bench::report("map_insert", container, n, ns, n);
+  s21::bench::report_metric("map_insert", container, n, "load_factor",
+                            map.load_factor());
+
+  std::mt19937 gen(7);
+  std::uniform_int_distribution<int> hit(0, int(n) - 1);
+  std::vector<int> lookups(kLookups);
+  for (int& key : lookups) {
+    key = hit(gen);
+  }
+
+  int64_t total = 0;
+  ns = s21::bench::measure_ns([&] {
+    for (int key : lookups) {
+      total += map.find(key)->second;
+    }
+  });
+  s21::bench::do_not_optimize(total);
+  s21::bench::report("map_find", container, n, ns, kLookups);
+
+  size_t found = 0;
+  ns = s21::bench::measure_ns([&] {
+    for (int key : lookups) {
+      found += contains(map, key + int(n));
+    }
+  });
+  s21::bench::do_not_optimize(found);
+  s21::bench::report("map_find_miss", container, n, ns, kLookups);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  size_t max_size = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+
+  s21::bench::print_header();
+  for (size_t n = 1000; n <= max_size; n *= 10) {
+    run_map<s21::Map<int, int>>("s21::Map", n);
+    run_map<std::unordered_map<int, int>>("std::unordered_map", n);
+  }
+
+  return 0;
+}
@@ -0,0 +1,135 @@
+#include <cstdint>
+#include <list>
+#include <memory>
+
+#include "bench.h"
+#include "s21_list.h"
+
+namespace {
+
+// List with the pre-pool representation: one make_shared per element,
+// shared_ptr next and weak_ptr prev links, and iterators that lock a weak_ptr
+// on every step
+template <typename T>
+class SharedNodeList {
+  struct Node {
+    explicit Node(const T& value) : data(value) {}
+    std::shared_ptr<Node> next;
+    std::weak_ptr<Node> prev;
+    T data;
+  };
+
+ public:
+  ~SharedNodeList() {
+    while (head_) {
+      pop_front();
+    }
+  }
+
+  void push_back(const T& value) {
+    auto ptr = std::make_shared<Node>(value);
+    if (!head_) {
+      head_ = tail_ = ptr;
+    } else {
+      ptr->prev = tail_;
+      tail_->next = ptr;
+      tail_ = ptr;
+    }
+    ++size_;
+  }
+
+  void pop_front() {
+    head_ = head_->next;
+    if (head_) {
+      head_->prev.reset();
+    } else {
+      tail_ = nullptr;
+    }
+    --size_;
+  }
+
+  template <typename F>
+  void for_each(F&& fn) const {
+    std::weak_ptr<Node> it = head_;
+    while (auto ptr = it.lock()) {
+      fn(ptr->data);
+      it = ptr->next;
+    }
+  }
+
+  bool empty() const noexcept { return !size_; }
+  size_t size() const noexcept { return size_; }
+
+ private:
+  std::shared_ptr<Node> head_;
+  std::shared_ptr<Node> tail_;
+  size_t size_{};
+};
+
+template <typename List, typename F>
+void iterate(const List& l, F&& fn) {
+  for (const auto& el : l) {
+    fn(el);
+  }
+}
+
+template <typename T, typename F>
+void iterate(const SharedNodeList<T>& l, F&& fn) {
+  l.for_each(fn);
+}
+
+template <typename List>
+void run_list(const char* container, size_t n) {
+  List l;
+  double ns = s21::bench::measure_ns([&] {
+    for (size_t i = 0; i < n; ++i) {
+      l.push_back(int(i));
+    }
+  });
+  s21::bench::report("list_push_back", container, n, ns, n);
+
+  int64_t total = 0;
+  ns = s21::bench::measure_ns([&] {
+    iterate(l, [&](int el) { total += el; });
+  });
+  s21::bench::do_not_optimize(total);
+  s21::bench::report("list_iterate", container, n, ns, n);
+
+  ns = s21::bench::measure_ns([&] {
+    while (!l.empty()) {
+      l.pop_front();
+    }
+  });
+  s21::bench::report("list_pop_front", container, n, ns, n);
+
+  // Steady state FIFO: every push reuses the node the previous pop freed
+  ns = s21::bench::measure_ns([&] {
+    for (size_t i = 0; i < n; ++i) {
+      l.push_back(int(i));
+      l.pop_front();
+    }
+  });
+  s21::bench::report("list_push_pop", container, n, ns, n);
+
+  ns = s21::bench::measure_ns([&] {
+    List filled;
+    for (size_t i = 0; i < n; ++i) {
+      filled.push_back(int(i));
+    }
+  });
+  s21::bench::report("list_fill_and_destroy", container, n, ns, n);
+}
+
+}  // namespace
+
+int main() {
+  s21::bench::print_header();
+
+  for (size_t n : {1000UL, 100000UL, 1000000UL}) {
+    run_list<s21::List<int>>("s21::List", n);
+    run_list<SharedNodeList<int>>("shared_node_list", n);
+    run_list<std::list<int>>("std::list", n);
+  }
+
+  return 0;
+}
@@ -0,0 +1,55 @@
+#include <cstdint>
+#include <cstdlib>
+#include <list>
+#include <memory>
+
+#include "bench.h"
+#include "s21_list.h"
+
+// Stress test for building and tearing down very long lists.
+// Usage: list_teardown.bench [size] (default 5e7). Teardown rows time the
+// destructor alone; their ns_per_op is per element.
+namespace {
+
+int64_t destroyed_total = 0;
+
+// Non-trivial destructor, so teardown has to visit every node
+struct Payload {
+  explicit Payload(int v) : value(v) {}
+  Payload(const Payload& other) = default;
+  ~Payload() { destroyed_total += value; }
+
+  int value;
+};
+
+template <typename List>
+void run_teardown(const char* benchmark, const char* container, size_t n) {
+  auto l = std::make_unique<List>();
+  double ns = s21::bench::measure_ns([&] {
+    for (size_t i = 0; i < n; ++i) {
+      l->push_back(typename List::value_type(int(i & 0xff)));
+    }
+  });
+  s21::bench::report(benchmark, container, n, ns, n);
+
+  ns = s21::bench::measure_ns([&] { l.reset(); });
+  s21::bench::report_metric("list_teardown", container, n, "ns_per_op",
+                            ns / n);
+  s21::bench::report_metric("list_teardown", container, n, "total_ms",
+                            ns / 1e6);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 50000000;
+
+  s21::bench::print_header();
+  run_teardown<s21::List<int>>("list_fill", "s21::List<int>", n);
+  run_teardown<std::list<int>>("list_fill", "std::list<int>", n);
+  run_teardown<s21::List<Payload>>("list_fill", "s21::List<Payload>", n);
+  run_teardown<std::list<Payload>>("list_fill", "std::list<Payload>", n);
+  s21::bench::do_not_optimize(destroyed_total);
+
+  return 0;
+}
@@ -0,0 +1,136 @@
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "bench.h"
+#include "../s21_containers.h"
+
+// Multi-threaded throughput of s21::mpmc_queue against s21::queue behind a
+// mutex. Usage: mpmc_queue.bench [items] (default 2e6 per configuration).
+// Each row moves `items` values from P producers to P consumers; size is
+// the thread count on each side.
+namespace {
+
+constexpr size_t kCapacity = 1024;
+constexpr size_t kBatch = 32;
+
+// s21::queue guarded by one mutex, with the same try_push/try_pop surface
+class LockedQueue {
+ public:
+  bool try_push(int value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.size() == kCapacity) {
+      return false;
+    }
+    queue_.push(value);
+    return true;
+  }
+
+  bool try_pop(int& value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.empty()) {
+      return false;
+    }
+    value = queue_.front();
+    queue_.pop();
+    return true;
+  }
+
+ private:
+  std::mutex mutex_;
+  s21::queue<int> queue_;
+};
+
+template <typename Queue, typename Produce, typename Consume>
+void run(const char* benchmark, const char* container, size_t threads,
+         size_t items, Produce produce, Consume consume) {
+  Queue q;
+  std::atomic<int64_t> total{0};
+  size_t per_thread = items / threads;
+  double ns = s21::bench::measure_ns([&] {
+    std::vector<std::thread> workers;
+    for (size_t t = 0; t < threads; ++t) {
+      workers.emplace_back([&] { produce(q, per_thread); });
+      workers.emplace_back([&] { total += consume(q, per_thread); });
+    }
+    for (auto& worker : workers) {
+      worker.join();
+    }
+  });
+  s21::bench::do_not_optimize(total.load());
+  s21::bench::report(benchmark, container, threads, ns, per_thread * threads);
+  s21::bench::report_metric(benchmark, container, threads, "mops_per_s",
+                            per_thread * threads / ns * 1e3);
+}
+
+// Spin on the try_ variants, yielding between failed attempts, so the
+// locked baseline and the ring wait the same way
+template <typename Queue>
+void produce_one(Queue& q, size_t n) {
+  for (size_t i = 0; i < n; ++i) {
+    while (!q.try_push(int(i))) {
+      std::this_thread::yield();
+    }
+  }
+}
+
+template <typename Queue>
+int64_t consume_one(Queue& q, size_t n) {
+  int64_t sum = 0;
+  int value = 0;
+  for (size_t i = 0; i < n; ++i) {
+    while (!q.try_pop(value)) {
+      std::this_thread::yield();
+    }
+    sum += value;
+  }
+  return sum;
+}
+
+struct Ring : s21::mpmc_queue<int> {
+  Ring() : s21::mpmc_queue<int>(kCapacity) {}
+};
+
+void produce_batch(Ring& q, size_t n) {
+  int batch[kBatch];
+  for (size_t i = 0; i < n; i += kBatch) {
+    size_t count = std::min(kBatch, n - i);
+    std::fill_n(batch, count, int(i));
+    q.push_many(batch, count);
+  }
+}
+
+int64_t consume_batch(Ring& q, size_t n) {
+  int64_t sum = 0;
+  int batch[kBatch];
+  for (size_t done = 0; done < n;) {
+    size_t count = q.pop_many(batch, std::min(kBatch, n - done));
+    for (size_t i = 0; i < count; ++i) {
+      sum += batch[i];
+    }
+    done += count;
+  }
+  return sum;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  size_t items = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 2000000;
+
+  s21::bench::print_header();
+  for (size_t threads : {1UL, 2UL, 4UL, 8UL}) {
+    run<LockedQueue>("queue_throughput", "mutex+s21::queue", threads, items,
+                     produce_one<LockedQueue>, consume_one<LockedQueue>);
+    run<Ring>("queue_throughput", "s21::mpmc_queue", threads, items,
+              produce_one<Ring>, consume_one<Ring>);
+    run<Ring>("queue_throughput_batch", "s21::mpmc_queue", threads, items,
+              produce_batch, consume_batch);
+  }
+
+  return 0;
+}
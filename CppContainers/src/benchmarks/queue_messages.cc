@@ -0,0 +1,43 @@
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "bench.h"
+#include "../s21_containers.h"
+
+// Enqueueing large messages into s21::queue by copy, by move and in place.
+namespace {
+
+constexpr size_t kMessageBytes = 4096;
+
+template <typename Push>
+void run_queue(const char* benchmark, size_t n, Push push) {
+  std::vector<std::string> messages(n, std::string(kMessageBytes, 'm'));
+  s21::queue<std::string> q;
+  double ns = s21::bench::measure_ns([&] {
+    for (auto& message : messages) {
+      push(q, message);
+    }
+  });
+  s21::bench::do_not_optimize(q.size());
+  s21::bench::report(benchmark, "s21::queue<std::string>", n, ns, n);
+}
+
+}  // namespace
+
+int main() {
+  s21::bench::print_header();
+
+  for (size_t n : {1000UL, 100000UL}) {
+    run_queue("queue_push_copy", n,
+              [](auto& q, std::string& message) { q.push(message); });
+    run_queue("queue_push_move", n, [](auto& q, std::string& message) {
+      q.push(std::move(message));
+    });
+    run_queue("queue_emplace", n, [](auto& q, std::string&) {
+      q.emplace(kMessageBytes, 'm');
+    });
+  }
+
+  return 0;
+}
@@ -0,0 +1,70 @@
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "bench.h"
+#include "s21_small_vector.h"
+#include "s21_vector.h"
+
+namespace {
+std::atomic<size_t> allocations{0};
+}  // namespace
+
+void* operator new(size_t size) {
+  allocations.fetch_add(1, std::memory_order_relaxed);
+  if (void* ptr = std::malloc(size ? size : 1)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { std::free(ptr); }
+
+namespace {
+
+constexpr size_t kRounds = 1000000;
+
+// Builds and drops kRounds short-lived collections of `elements` items each,
+// the way request handlers use temporaries
+template <typename Vec, typename T>
+void run_temporaries(const char* container, const char* type, size_t elements,
+                     const T& value) {
+  size_t before = allocations.load();
+  double ns = s21::bench::measure_ns([&] {
+    for (size_t round = 0; round < kRounds; ++round) {
+      Vec v;
+      for (size_t i = 0; i < elements; ++i) {
+        v.push_back(value);
+      }
+      s21::bench::do_not_optimize(v.data());
+    }
+  });
+  size_t allocs = allocations.load() - before;
+
+  std::string name = std::string("small_temporaries_") + type;
+  s21::bench::report(name.c_str(), container, elements, ns, kRounds);
+  s21::bench::report_metric(name.c_str(), container, elements,
+                            "allocs_per_op", double(allocs) / kRounds);
+}
+
+}  // namespace
+
+int main() {
+  s21::bench::print_header();
+
+  for (size_t n : {1UL, 4UL, 8UL, 16UL}) {
+    run_temporaries<s21::Vector<int>>("s21::Vector", "int", n, 7);
+    run_temporaries<s21::SmallVector<int, 8>>("s21::SmallVector<8>", "int", n,
+                                              7);
+    run_temporaries<std::vector<int>>("std::vector", "int", n, 7);
+
+    run_temporaries<s21::Vector<double>>("s21::Vector", "double", n, 0.5);
+    run_temporaries<s21::SmallVector<double, 8>>("s21::SmallVector<8>",
+                                                 "double", n, 0.5);
+  }
+
+  return 0;
+}
@@ -0,0 +1,106 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+
+#include "bench.h"
+#include "../s21_containers.h"
+
+// s21::UnrolledList against s21::List on FIFO work-buffer patterns, plus
+// the heap bytes each one holds per element.
+namespace {
+
+size_t allocated_bytes = 0;
+
+// std::allocator that tallies the bytes currently handed out
+template <typename T>
+struct TallyAllocator {
+  using value_type = T;
+
+  TallyAllocator() = default;
+  template <typename U>
+  TallyAllocator(const TallyAllocator<U>&) noexcept {}
+
+  T* allocate(size_t n) {
+    allocated_bytes += n * sizeof(T);
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T* p, size_t n) noexcept {
+    allocated_bytes -= n * sizeof(T);
+    std::allocator<T>().deallocate(p, n);
+  }
+
+  bool operator==(const TallyAllocator&) const noexcept { return true; }
+  bool operator!=(const TallyAllocator&) const noexcept { return false; }
+};
+
+template <typename List>
+void run_list(const char* container, size_t n) {
+  size_t rounds = std::max<size_t>(1, 1000000 / n);
+
+  double ns = 0;
+  for (size_t r = 0; r < rounds; ++r) {
+    ns += s21::bench::measure_ns([&] {
+      List l;
+      for (size_t i = 0; i < n; ++i) {
+        l.push_back(int(i));
+      }
+      s21::bench::do_not_optimize(l.size());
+    });
+  }
+  s21::bench::report("push_back", container, n, ns, rounds * n);
+
+  List l;
+  for (size_t i = 0; i < n; ++i) {
+    l.push_back(int(i));
+  }
+  s21::bench::report_metric("memory", container, n, "bytes_per_element",
+                            double(allocated_bytes) / n);
+
+  int64_t total = 0;
+  ns = 0;
+  for (size_t r = 0; r < rounds; ++r) {
+    ns += s21::bench::measure_ns([&] {
+      for (int el : l) {
+        total += el;
+      }
+    });
+  }
+  s21::bench::do_not_optimize(total);
+  s21::bench::report("iterate", container, n, ns, rounds * n);
+
+  // Work buffer at a steady depth of n: every push is matched by a pop
+  ns = s21::bench::measure_ns([&] {
+    for (size_t i = 0; i < rounds * n; ++i) {
+      l.push_back(int(i));
+      total += l.front();
+      l.pop_front();
+    }
+  });
+  s21::bench::do_not_optimize(total);
+  s21::bench::report("fifo_push_pop", container, n, ns, rounds * n);
+
+  ns = s21::bench::measure_ns([&] {
+    while (!l.empty()) {
+      l.pop_front();
+    }
+  });
+  s21::bench::report("pop_front", container, n, ns, n);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  size_t max_size = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+
+  s21::bench::print_header();
+  for (size_t n = 1000; n <= max_size; n *= 10) {
+    run_list<s21::List<int, TallyAllocator<int>>>("s21::List", n);
+    run_list<s21::UnrolledList<int, 512, TallyAllocator<int>>>(
+        "s21::UnrolledList<512>", n);
+    run_list<s21::UnrolledList<int, 4096, TallyAllocator<int>>>(
+        "s21::UnrolledList<4096>", n);
+  }
+
+  return 0;
+}
@@ -0,0 +1,59 @@
+#include <string>
+#include <vector>
+
+#include "bench.h"
+#include "s21_vector.h"
+
+namespace {
+
+// Vector with the pre-relocation growth path: every reserve copies the
+// elements into the new buffer instead of moving them
+template <typename T>
+class CopyGrowthVector : public s21::Vector<T> {
+ public:
+  void push_back(const T& value) {
+    if (this->size() == this->capacity()) {
+      s21::Vector<T> grown;
+      grown.reserve(this->capacity() ? this->capacity() * 2 : 2);
+      for (auto it = this->data(); it != this->data() + this->size(); ++it) {
+        grown.push_back(*it);
+      }
+      this->swap(grown);
+    }
+    s21::Vector<T>::push_back(value);
+  }
+};
+
+template <typename Vec, typename T>
+void run_growth(const char* container, const char* type, size_t n,
+                const T& value) {
+  double ns = s21::bench::measure_ns([&] {
+    Vec v;
+    for (size_t i = 0; i < n; ++i) {
+      v.push_back(value);
+    }
+    s21::bench::do_not_optimize(v.size());
+  });
+  std::string name = std::string("growth_push_back_") + type;
+  s21::bench::report(name.c_str(), container, n, ns, n);
+}
+
+}  // namespace
+
+int main() {
+  s21::bench::print_header();
+  const std::string payload(64, 'x');
+
+  for (size_t n : {1000UL, 100000UL, 1000000UL}) {
+    run_growth<s21::Vector<int>>("s21::Vector", "int", n, 42);
+    run_growth<CopyGrowthVector<int>>("copy_growth", "int", n, 42);
+    run_growth<std::vector<int>>("std::vector", "int", n, 42);
+
+    run_growth<s21::Vector<std::string>>("s21::Vector", "string", n, payload);
+    run_growth<CopyGrowthVector<std::string>>("copy_growth", "string", n,
+                                              payload);
+    run_growth<std::vector<std::string>>("std::vector", "string", n, payload);
+  }
+
+  return 0;
+}
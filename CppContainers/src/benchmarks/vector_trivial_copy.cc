@@ -0,0 +1,94 @@
+#include "bench.h"
+#include "s21_array.h"
+#include "s21_vector.h"
+
+namespace {
+
+constexpr size_t kElements = 1000000;
+constexpr int kRepeats = 20;
+
+// Same layout as int, but the user-provided copy operations rule out the
+// memcpy/memmove/memset paths, so every operation goes element by element
+struct BoxedInt {
+  int value{};
+
+  BoxedInt() = default;
+  BoxedInt(int v) : value(v) {}
+  BoxedInt(const BoxedInt& other) : value(other.value) {}
+  BoxedInt& operator=(const BoxedInt& other) {
+    value = other.value;
+    return *this;
+  }
+};
+
+template <typename T>
+void run_operations(const char* container) {
+  s21::Vector<T> source(kElements, T(7));
+
+  double ns = s21::bench::measure_ns([&] {
+    for (int i = 0; i < kRepeats; ++i) {
+      s21::Vector<T> copy(source);
+      s21::bench::do_not_optimize(copy.data());
+    }
+  });
+  s21::bench::report("copy_construct", container, kElements, ns,
+                     kRepeats * kElements);
+
+  ns = 0;
+  for (int i = 0; i < kRepeats; ++i) {
+    s21::Vector<T> v(source);
+    v.reserve(kElements * 2);
+    ns += s21::bench::measure_ns([&] { v.shrink_to_fit(); });
+    s21::bench::do_not_optimize(v.data());
+  }
+  s21::bench::report("shrink_to_fit", container, kElements, ns,
+                     kRepeats * kElements);
+
+  s21::Vector<T> v(source);
+  v.reserve(kElements + kRepeats * 4);
+  ns = s21::bench::measure_ns([&] {
+    for (int i = 0; i < kRepeats; ++i) {
+      v.insert_many(v.begin(), T(1), T(2), T(3), T(4));
+    }
+  });
+  s21::bench::report("insert_many_front", container, kElements, ns,
+                     kRepeats * kElements);
+
+  ns = s21::bench::measure_ns([&] {
+    for (int i = 0; i < kRepeats; ++i) {
+      v.erase(v.begin());
+    }
+  });
+  s21::bench::report("erase_front", container, kElements, ns,
+                     kRepeats * kElements);
+
+  auto* array = new s21::Array<T, kElements>();
+  ns = s21::bench::measure_ns([&] {
+    for (int i = 0; i < kRepeats; ++i) {
+      array->fill(T(0));
+      s21::bench::do_not_optimize(array->begin());
+    }
+  });
+  s21::bench::report("array_fill_zero", container, kElements, ns,
+                     kRepeats * kElements);
+
+  ns = s21::bench::measure_ns([&] {
+    for (int i = 0; i < kRepeats; ++i) {
+      array->fill(T(0x01020304));
+      s21::bench::do_not_optimize(array->begin());
+    }
+  });
+  s21::bench::report("array_fill_pattern", container, kElements, ns,
+                     kRepeats * kElements);
+  delete array;
+}
+
+}  // namespace
+
+int main() {
+  s21::bench::print_header();
+  run_operations<int>("s21::Vector<int>");
+  run_operations<BoxedInt>("s21::Vector<BoxedInt>");
+
+  return 0;
+}
@@ -0,0 +1,170 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <utility>
+
+#include "hash_table.h"
+
+namespace s21 {
+
+// Hash map shared by many threads. Keys are split across Shards hash_table
+// shards, each behind its own std::shared_mutex: lookups in a shard share
+// its lock, and a writer only blocks the keys of its own shard.
+//
+// The shard comes from the top bits of the Fibonacci-hashed key hash
+// (PowerOfTwoBuckets), while each shard's table picks buckets with
+// hash % bucket_count, so the keys of one shard still spread over all of
+// its buckets.
+//
+// Nothing returns references or iterators, since they would outlive the
+// lock; find and compute_if_absent return copies of the value.
+template <typename K, typename V, typename H = std::hash<K>,
+          size_t Shards = 16>
+class ConcurrentMap {
+  static_assert(Shards && !(Shards & (Shards - 1)),
+                "ConcurrentMap shard count must be a power of two");
+
+ public:
+  using table = hash_table<K, V, H>;
+  using key_type = K;
+  using mapped_type = V;
+  using value_type = std::pair<key_type, mapped_type>;
+  using size_type = size_t;
+
+  ConcurrentMap() = default;
+  ConcurrentMap(const ConcurrentMap& other) = delete;
+  ConcurrentMap& operator=(const ConcurrentMap& other) = delete;
+  ~ConcurrentMap() = default;
+
+  static constexpr size_type shard_count() noexcept { return Shards; }
+  // Only a snapshot while other threads are writing
+  size_type size() const;
+  bool empty() const { return !size(); }
+  void clear();
+
+  std::optional<mapped_type> find(const key_type& key) const;
+  bool contains(const key_type& key) const;
+  // Returns true when key was inserted, false when its value was replaced
+  bool insert_or_assign(const key_type& key, const mapped_type& value);
+  // Returns the number of erased entries, 0 or 1
+  size_type erase(const key_type& key);
+  // Returns the value of key, first inserting make(key) when key is
+  // missing. make runs under the shard's exclusive lock, so it is called
+  // once per inserted key and must not use the map itself.
+  template <typename F>
+  mapped_type compute_if_absent(const key_type& key, F&& make);
+
+ private:
+  static constexpr size_t kCacheLine = 64;
+
+  // One cache line or more each, so threads locking neighbouring shards
+  // don't keep stealing each other's lock word
+  struct alignas(kCacheLine) Shard {
+    mutable std::shared_mutex mutex;
+    table entries;
+  };
+
+  using read_lock = std::shared_lock<std::shared_mutex>;
+  using write_lock = std::unique_lock<std::shared_mutex>;
+
+  Shard& shard_for(const key_type& key) {
+    return shards_[PowerOfTwoBuckets::index(H()(key), Shards)];
+  }
+  const Shard& shard_for(const key_type& key) const {
+    return shards_[PowerOfTwoBuckets::index(H()(key), Shards)];
+  }
+
+  Shard shards_[Shards];
+};
+
+template <typename K, typename V, typename H, size_t Shards>
+typename ConcurrentMap<K, V, H, Shards>::size_type
+ConcurrentMap<K, V, H, Shards>::size() const {
+  size_type total = 0;
+  for (const Shard& shard : shards_) {
+    read_lock lock(shard.mutex);
+    total += shard.entries.size();
+  }
+
+  return total;
+}
+
+template <typename K, typename V, typename H, size_t Shards>
+void ConcurrentMap<K, V, H, Shards>::clear() {
+  for (Shard& shard : shards_) {
+    write_lock lock(shard.mutex);
+    shard.entries.clear();
+  }
+}
+
+template <typename K, typename V, typename H, size_t Shards>
+std::optional<typename ConcurrentMap<K, V, H, Shards>::mapped_type>
+ConcurrentMap<K, V, H, Shards>::find(const key_type& key) const {
+  const Shard& shard = shard_for(key);
+  read_lock lock(shard.mutex);
+  auto it = shard.entries.find(key);
+  if (it == shard.entries.end()) {
+    return std::nullopt;
+  }
+
+  return it->second;
+}
+
+template <typename K, typename V, typename H, size_t Shards>
+bool ConcurrentMap<K, V, H, Shards>::contains(const key_type& key) const {
+  const Shard& shard = shard_for(key);
+  read_lock lock(shard.mutex);
+
+  return shard.entries.contains(key);
+}
+
+template <typename K, typename V, typename H, size_t Shards>
+bool ConcurrentMap<K, V, H, Shards>::insert_or_assign(
+    const key_type& key, const mapped_type& value) {
+  Shard& shard = shard_for(key);
+  write_lock lock(shard.mutex);
+
+  return shard.entries.insert_or_assign(key, value).second;
+}
+
+template <typename K, typename V, typename H, size_t Shards>
+typename ConcurrentMap<K, V, H, Shards>::size_type
+ConcurrentMap<K, V, H, Shards>::erase(const key_type& key) {
+  Shard& shard = shard_for(key);
+  write_lock lock(shard.mutex);
+
+  return shard.entries.erase(key);
+}
+
+// Looks under the shared lock first, so hits don't serialize; a miss
+// retakes the lock exclusively and checks again, since another thread may
+// have inserted key in between
+template <typename K, typename V, typename H, size_t Shards>
+template <typename F>
+typename ConcurrentMap<K, V, H, Shards>::mapped_type
+ConcurrentMap<K, V, H, Shards>::compute_if_absent(const key_type& key,
+                                                  F&& make) {
+  Shard& shard = shard_for(key);
+  const table& entries = shard.entries;
+  {
+    read_lock lock(shard.mutex);
+    auto it = entries.find(key);
+    if (it != entries.end()) {
+      return it->second;
+    }
+  }
+
+  write_lock lock(shard.mutex);
+  auto it = shard.entries.find(key);
+  if (it != shard.entries.end()) {
+    return it->second;
+  }
+
+  return shard.entries.insert(key, std::forward<F>(make)(key)).first->second;
+}
+
+}  // namespace s21
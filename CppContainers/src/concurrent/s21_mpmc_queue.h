@@ -0,0 +1,385 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+namespace detail {
+
+// Spins with a growing number of pause instructions, then starts yielding
+// the thread, for the blocking mpmc_queue operations
+class Backoff {
+ public:
+  void pause() noexcept {
+    if (spins_ < kSpinLimit) {
+      for (unsigned i = 0; i < 1U << spins_; ++i) {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#endif
+      }
+      ++spins_;
+    } else {
+      std::this_thread::yield();
+    }
+  }
+
+ private:
+  static constexpr unsigned kSpinLimit = 6;
+  unsigned spins_{};
+};
+
+}  // namespace detail
+
+// Bounded multi-producer multi-consumer queue after Dmitry Vyukov's design:
+// a power-of-two ring of slots, each with a sequence number that says
+// whether it is ready for the producer or the consumer of a given position.
+// Producers and consumers each claim positions with a single CAS on their
+// own counter and never take a lock. Nothing is allocated after
+// construction.
+//
+// Elements must be nothrow movable, so a claimed slot is always published.
+// Batch pushes construct in place only when that cannot throw; otherwise
+// they fall back to pushing element by element.
+template <typename T>
+class mpmc_queue {
+  static_assert(std::is_nothrow_move_constructible_v<T> &&
+                    std::is_nothrow_move_assignable_v<T>,
+                "mpmc_queue elements must be nothrow movable");
+
+ public:
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = size_t;
+
+  // capacity is rounded up to a power of two, at least 2
+  explicit mpmc_queue(size_type capacity);
+  mpmc_queue(const mpmc_queue& other) = delete;
+  mpmc_queue& operator=(const mpmc_queue& other) = delete;
+  ~mpmc_queue();
+
+  size_type capacity() const noexcept { return mask_ + 1; }
+  // Only a snapshot while other threads are pushing or popping
+  size_type size() const noexcept;
+  bool empty() const noexcept { return !size(); }
+
+  // Return false instead of waiting when the queue is full or empty
+  bool try_push(const_reference value);
+  bool try_push(value_type&& value);
+  template <typename... Args>
+  bool try_emplace(Args&&... args);
+  bool try_pop(reference value);
+
+  // Wait, spinning and then yielding, until there is room or an element
+  void push(const_reference value);
+  void push(value_type&& value);
+  template <typename... Args>
+  void emplace(Args&&... args);
+  void pop(reference value);
+
+  // Claim a run of slots with one CAS. try_push_many constructs elements
+  // from first[0..count) (wrap the iterator in std::make_move_iterator to
+  // move) and returns how many it took; try_pop_many moves up to
+  // max_count elements into out and returns how many it moved.
+  template <typename It>
+  size_type try_push_many(It first, size_type count);
+  size_type try_pop_many(T* out, size_type max_count);
+  // push_many waits until all count elements are in; pop_many waits for at
+  // least one element
+  template <typename It>
+  void push_many(It first, size_type count);
+  size_type pop_many(T* out, size_type max_count);
+
+ private:
+  static constexpr size_t kCacheLine = 64;
+
+  struct Slot {
+    std::atomic<size_t> sequence;
+    alignas(T) unsigned char storage[sizeof(T)];
+
+    T* value() noexcept { return std::launder(reinterpret_cast<T*>(storage)); }
+  };
+
+  // Claim up to count consecutive positions; returns the first and sets
+  // count to how many were claimed (0 when full or empty)
+  size_t claim_push(size_type& count) noexcept;
+  size_t claim_pop(size_type& count) noexcept;
+  void publish_push(size_t pos) noexcept;
+  void publish_pop(size_t pos) noexcept;
+
+  std::unique_ptr<Slot[]> slots_;
+  size_t mask_;
+  alignas(kCacheLine) std::atomic<size_t> enqueue_pos_{0};
+  alignas(kCacheLine) std::atomic<size_t> dequeue_pos_{0};
+};
+
+template <typename T>
+mpmc_queue<T>::mpmc_queue(size_type capacity) {
+  if (capacity > (std::numeric_limits<size_type>::max() >> 1)) {
+    throw std::length_error("Error: mpmc_queue capacity is too large");
+  }
+
+  size_t rounded = 2;
+  while (rounded < capacity) {
+    rounded <<= 1;
+  }
+  try {
+    slots_ = std::make_unique<Slot[]>(rounded);
+  } catch (std::bad_alloc& e) {
+    throw std::runtime_error("Error: failed to allocate memory");
+  }
+  mask_ = rounded - 1;
+  for (size_t i = 0; i < rounded; ++i) {
+    slots_[i].sequence.store(i, std::memory_order_relaxed);
+  }
+}
+
+template <typename T>
+mpmc_queue<T>::~mpmc_queue() {
+  if constexpr (!std::is_trivially_destructible_v<T>) {
+    size_t last = enqueue_pos_.load(std::memory_order_acquire);
+    for (size_t pos = dequeue_pos_.load(std::memory_order_acquire);
+         pos != last; ++pos) {
+      std::destroy_at(slots_[pos & mask_].value());
+    }
+  }
+}
+
+template <typename T>
+typename mpmc_queue<T>::size_type mpmc_queue<T>::size() const noexcept {
+  size_t head = dequeue_pos_.load(std::memory_order_acquire);
+  size_t tail = enqueue_pos_.load(std::memory_order_acquire);
+
+  return tail > head ? tail - head : 0;
+}
+
+// A slot is free for position pos once its sequence equals pos, and holds
+// the element for pos once its sequence equals pos + 1. Every slot of the
+// run is checked before the CAS; a ready slot stays ready until whoever
+// claims its position moves on.
+template <typename T>
+size_t mpmc_queue<T>::claim_push(size_type& count) noexcept {
+  size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+  while (count) {
+    size_t ready = 0;
+    while (ready < count &&
+           slots_[(pos + ready) & mask_].sequence.load(
+               std::memory_order_acquire) == pos + ready) {
+      ++ready;
+    }
+
+    if (ready) {
+      if (enqueue_pos_.compare_exchange_weak(pos, pos + ready,
+                                             std::memory_order_relaxed)) {
+        count = ready;
+        return pos;
+      }
+      continue;
+    }
+
+    size_t seq = slots_[pos & mask_].sequence.load(std::memory_order_acquire);
+    if (intptr_t(seq - pos) < 0) {
+      count = 0;
+      return pos;
+    }
+    pos = enqueue_pos_.load(std::memory_order_relaxed);
+  }
+
+  return pos;
+}
+
+template <typename T>
+size_t mpmc_queue<T>::claim_pop(size_type& count) noexcept {
+  size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+  while (count) {
+    size_t ready = 0;
+    while (ready < count &&
+           slots_[(pos + ready) & mask_].sequence.load(
+               std::memory_order_acquire) == pos + ready + 1) {
+      ++ready;
+    }
+
+    if (ready) {
+      if (dequeue_pos_.compare_exchange_weak(pos, pos + ready,
+                                             std::memory_order_relaxed)) {
+        count = ready;
+        return pos;
+      }
+      continue;
+    }
+
+    size_t seq = slots_[pos & mask_].sequence.load(std::memory_order_acquire);
+    if (intptr_t(seq - (pos + 1)) < 0) {
+      count = 0;
+      return pos;
+    }
+    pos = dequeue_pos_.load(std::memory_order_relaxed);
+  }
+
+  return pos;
+}
+
+template <typename T>
+void mpmc_queue<T>::publish_push(size_t pos) noexcept {
+  slots_[pos & mask_].sequence.store(pos + 1, std::memory_order_release);
+}
+
+template <typename T>
+void mpmc_queue<T>::publish_pop(size_t pos) noexcept {
+  slots_[pos & mask_].sequence.store(pos + mask_ + 1,
+                                     std::memory_order_release);
+}
+
+template <typename T>
+bool mpmc_queue<T>::try_push(const_reference value) {
+  return try_emplace(value);
+}
+
+template <typename T>
+bool mpmc_queue<T>::try_push(value_type&& value) {
+  return try_emplace(std::move(value));
+}
+
+template <typename T>
+template <typename... Args>
+bool mpmc_queue<T>::try_emplace(Args&&... args) {
+  if constexpr (!std::is_nothrow_constructible_v<T, Args&&...>) {
+    // Build the element before claiming a slot, so a throwing constructor
+    // can't leave a claimed slot unpublished
+    T value(std::forward<Args>(args)...);
+    return try_emplace(std::move(value));
+  } else {
+    size_type count = 1;
+    size_t pos = claim_push(count);
+    if (!count) {
+      return false;
+    }
+
+    ::new (static_cast<void*>(slots_[pos & mask_].storage))
+        T(std::forward<Args>(args)...);
+    publish_push(pos);
+    return true;
+  }
+}
+
+template <typename T>
+bool mpmc_queue<T>::try_pop(reference value) {
+  size_type count = 1;
+  size_t pos = claim_pop(count);
+  if (!count) {
+    return false;
+  }
+
+  T* slot = slots_[pos & mask_].value();
+  value = std::move(*slot);
+  std::destroy_at(slot);
+  publish_pop(pos);
+  return true;
+}
+
+template <typename T>
+void mpmc_queue<T>::push(const_reference value) {
+  emplace(value);
+}
+
+template <typename T>
+void mpmc_queue<T>::push(value_type&& value) {
+  emplace(std::move(value));
+}
+
+template <typename T>
+template <typename... Args>
+void mpmc_queue<T>::emplace(Args&&... args) {
+  if constexpr (!std::is_nothrow_constructible_v<T, Args&&...>) {
+    T value(std::forward<Args>(args)...);
+    emplace(std::move(value));
+  } else {
+    detail::Backoff backoff;
+    while (!try_emplace(std::forward<Args>(args)...)) {
+      backoff.pause();
+    }
+  }
+}
+
+template <typename T>
+void mpmc_queue<T>::pop(reference value) {
+  detail::Backoff backoff;
+  while (!try_pop(value)) {
+    backoff.pause();
+  }
+}
+
+template <typename T>
+template <typename It>
+typename mpmc_queue<T>::size_type mpmc_queue<T>::try_push_many(
+    It first, size_type count) {
+  if constexpr (!std::is_nothrow_constructible_v<T, decltype(*first)>) {
+    size_type pushed = 0;
+    while (pushed < count && try_emplace(*first)) {
+      ++first;
+      ++pushed;
+    }
+    return pushed;
+  } else {
+    size_t pos = claim_push(count);
+    for (size_type i = 0; i < count; ++i, ++first) {
+      ::new (static_cast<void*>(slots_[(pos + i) & mask_].storage)) T(*first);
+      publish_push(pos + i);
+    }
+    return count;
+  }
+}
+
+template <typename T>
+typename mpmc_queue<T>::size_type mpmc_queue<T>::try_pop_many(
+    T* out, size_type max_count) {
+  size_t pos = claim_pop(max_count);
+  for (size_type i = 0; i < max_count; ++i) {
+    T* slot = slots_[(pos + i) & mask_].value();
+    out[i] = std::move(*slot);
+    std::destroy_at(slot);
+    publish_pop(pos + i);
+  }
+
+  return max_count;
+}
+
+template <typename T>
+template <typename It>
+void mpmc_queue<T>::push_many(It first, size_type count) {
+  detail::Backoff backoff;
+  while (count) {
+    size_type pushed = try_push_many(first, count);
+    if (pushed) {
+      std::advance(first, pushed);
+      count -= pushed;
+      backoff = detail::Backoff();
+    } else {
+      backoff.pause();
+    }
+  }
+}
+
+template <typename T>
+typename mpmc_queue<T>::size_type mpmc_queue<T>::pop_many(
+    T* out, size_type max_count) {
+  detail::Backoff backoff;
+  size_type popped = 0;
+  while (max_count && !(popped = try_pop_many(out, max_count))) {
+    backoff.pause();
+  }
+
+  return popped;
+}
+
+}  // namespace s21
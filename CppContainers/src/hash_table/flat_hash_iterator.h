@@ -0,0 +1,155 @@
+#pragma once
+
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+template <typename, typename, typename, typename>
+class flat_hash_table;
+
+// Walks the control bytes of a flat_hash_table and stops on full slots
+// (non-negative bytes). Any insert or erase invalidates it.
+template <typename K, typename V>
+class base_flat_hash_iterator {
+ public:
+  template <typename, typename, typename, typename>
+  friend class flat_hash_table;
+  using key_type = K;
+  using mapped_type = std::remove_const_t<V>;
+  using value_type = std::pair<key_type, mapped_type>;
+  using reference = value_type&;
+  using pointer = value_type*;
+  using iterator_category = std::forward_iterator_tag;
+
+  base_flat_hash_iterator(const base_flat_hash_iterator& other) = default;
+  base_flat_hash_iterator(base_flat_hash_iterator&& other) noexcept = default;
+
+  base_flat_hash_iterator& operator=(const base_flat_hash_iterator& other) =
+      default;
+  base_flat_hash_iterator& operator=(base_flat_hash_iterator&& other) =
+      default;
+
+  reference operator*() const { return *slot_; }
+  pointer operator->() const { return slot_; }
+
+ protected:
+  base_flat_hash_iterator(const int8_t* ctrl, const int8_t* end,
+                          value_type* slot)
+      : ctrl_(ctrl), end_(end), slot_(slot) {}
+
+  void advance() {
+    if (ctrl_ == end_) {
+      throw std::out_of_range("Error: attempt to access beyond map");
+    }
+
+    do {
+      ++ctrl_;
+      ++slot_;
+    } while (ctrl_ != end_ && *ctrl_ < 0);
+  }
+
+  bool equals(const base_flat_hash_iterator& other) const {
+    return ctrl_ == other.ctrl_;
+  }
+
+  const int8_t* ctrl_;
+  const int8_t* end_;
+  value_type* slot_;
+};
+
+template <typename K, typename V>
+class flat_hash_iterator : public base_flat_hash_iterator<K, V> {
+ public:
+  template <typename, typename, typename, typename>
+  friend class flat_hash_table;
+  using base = base_flat_hash_iterator<K, V>;
+  using key_type = typename base::key_type;
+  using mapped_type = typename base::mapped_type;
+  using value_type = typename base::value_type;
+  using reference = typename base::reference;
+  using pointer = typename base::pointer;
+  using iterator_category = std::forward_iterator_tag;
+
+  flat_hash_iterator(const flat_hash_iterator& other) = default;
+  flat_hash_iterator(flat_hash_iterator&& other) noexcept = default;
+
+  flat_hash_iterator& operator=(const flat_hash_iterator& other) = default;
+  flat_hash_iterator& operator=(flat_hash_iterator&& other) = default;
+
+  flat_hash_iterator operator++() {
+    this->advance();
+
+    return *this;
+  }
+  flat_hash_iterator operator++(int) {
+    auto tmp{*this};
+    this->advance();
+
+    return tmp;
+  }
+
+  friend bool operator==(const flat_hash_iterator& a,
+                         const flat_hash_iterator& b) {
+    return a.equals(b);
+  }
+  friend bool operator!=(const flat_hash_iterator& a,
+                         const flat_hash_iterator& b) {
+    return !(a == b);
+  }
+
+ protected:
+  using base::base;
+};
+
+template <typename K, typename V>
+class const_flat_hash_iterator : public base_flat_hash_iterator<K, const V> {
+ public:
+  template <typename, typename, typename, typename>
+  friend class flat_hash_table;
+  using base = base_flat_hash_iterator<K, const V>;
+  using key_type = typename base::key_type;
+  using mapped_type = typename base::mapped_type;
+  using value_type = typename base::value_type;
+  using reference = typename base::reference;
+  using pointer = typename base::pointer;
+  using iterator_category = std::forward_iterator_tag;
+
+  const_flat_hash_iterator(const const_flat_hash_iterator& other) = default;
+  const_flat_hash_iterator(const_flat_hash_iterator&& other) noexcept =
+      default;
+
+  const_flat_hash_iterator& operator=(const const_flat_hash_iterator& other) =
+      default;
+  const_flat_hash_iterator& operator=(const_flat_hash_iterator&& other) =
+      default;
+
+  const_flat_hash_iterator operator++() {
+    this->advance();
+
+    return *this;
+  }
+  const_flat_hash_iterator operator++(int) {
+    auto tmp{*this};
+    this->advance();
+
+    return tmp;
+  }
+
+  friend bool operator==(const const_flat_hash_iterator& a,
+                         const const_flat_hash_iterator& b) {
+    return a.equals(b);
+  }
+  friend bool operator!=(const const_flat_hash_iterator& a,
+                         const const_flat_hash_iterator& b) {
+    return !(a == b);
+  }
+
+ protected:
+  using base::base;
+};
+
+}  // namespace s21
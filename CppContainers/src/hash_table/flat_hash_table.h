@@ -0,0 +1,607 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "flat_hash_iterator.h"
+#include "hash_traits.h"
+#include "s21_vector.h"
+
+namespace s21 {
+
+namespace detail {
+
+// Control byte of an empty slot. A full slot holds the low seven bits of its
+// key's hash, so it is never negative.
+constexpr int8_t kCtrlEmpty = -128;
+
+// Sixteen control bytes compared at once. Bit i of a returned mask stands
+// for byte i.
+class CtrlGroup {
+ public:
+  static constexpr size_t kWidth = 16;
+
+  explicit CtrlGroup(const int8_t* pos) noexcept {
+#if defined(__SSE2__)
+    ctrl_ = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pos));
+#else
+    std::memcpy(ctrl_, pos, kWidth);
+#endif
+  }
+
+  uint32_t match(int8_t h2) const noexcept {
+#if defined(__SSE2__)
+    return uint32_t(
+        _mm_movemask_epi8(_mm_cmpeq_epi8(ctrl_, _mm_set1_epi8(h2))));
+#else
+    uint32_t mask = 0;
+    for (size_t i = 0; i < kWidth; ++i) {
+      mask |= uint32_t(ctrl_[i] == h2) << i;
+    }
+    return mask;
+#endif
+  }
+
+  uint32_t match_empty() const noexcept { return match(kCtrlEmpty); }
+
+ private:
+#if defined(__SSE2__)
+  __m128i ctrl_;
+#else
+  int8_t ctrl_[kWidth];
+#endif
+};
+
+}  // namespace detail
+
+// Open-addressing counterpart of hash_table with the same interface, so Map
+// and Set can take either as their Table parameter. E compares keys.
+//
+// Entries live inline in one slot array. A parallel array of control bytes
+// is probed sixteen at a time with SSE2: a group load finds the slots whose
+// byte matches the key's seven hash bits, and a group with an empty byte
+// ends the search. Probing is linear from the key's home slot, which lets
+// erase shift the rest of the cluster back instead of leaving tombstones,
+// so lookups never slow down after erases. The first sixteen control bytes
+// are mirrored past the end so a group load never has to wrap.
+//
+// Inserts and erases move entries and invalidate every iterator.
+template <typename K, typename V, typename H = std::hash<K>,
+          typename E = detail::default_key_equal_t<H, K>>
+class flat_hash_table {
+ public:
+  using key_type = K;
+  using mapped_type = V;
+  using value_type = std::pair<key_type, mapped_type>;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using iterator = flat_hash_iterator<key_type, mapped_type>;
+  using const_iterator = const_flat_hash_iterator<key_type, mapped_type>;
+  using size_type = size_t;
+  using hasher = H;
+  using key_equal = E;
+
+  flat_hash_table() = default;
+  flat_hash_table(const flat_hash_table& other);
+  flat_hash_table(flat_hash_table&& other) noexcept;
+  ~flat_hash_table();
+
+  flat_hash_table& operator=(const flat_hash_table& other);
+  flat_hash_table& operator=(flat_hash_table&& other) noexcept;
+
+  size_type size() const noexcept { return size_; }
+  // Same as bucket_count()
+  size_type capacity() const noexcept { return capacity_; }
+  bool empty() const noexcept { return !size_; }
+  void clear();
+
+  // Number of slots: zero or a power of two
+  size_type bucket_count() const noexcept { return capacity_; }
+  float load_factor() const noexcept;
+  float max_load_factor() const noexcept { return max_load_factor_; }
+  // ml must be in (0, 1): probing relies on at least one empty slot
+  void max_load_factor(float ml);
+  void rehash(size_type count);
+  void reserve(size_type count);
+
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+
+  // at, erase(key), find and contains also take any Key that H hashes and
+  // E compares with key_type when both declare is_transparent
+  mapped_type& at(const key_type& key) { return at_key(key); }
+  template <typename Key, typename = detail::transparent_key_t<H, E, Key>>
+  mapped_type& at(const Key& key) {
+    return at_key(key);
+  }
+  mapped_type& operator[](const key_type& key);
+
+  void erase(iterator pos);
+  // Returns the number of erased entries, 0 or 1
+  size_type erase(const key_type& key) { return erase_key(key); }
+  template <typename Key, typename = detail::transparent_key_t<H, E, Key>>
+  size_type erase(const Key& key) {
+    return erase_key(key);
+  }
+  void swap(flat_hash_table& other) noexcept;
+
+  template <typename... Args>
+  s21::Vector<std::pair<iterator, bool>> insert_many(Args&&... args);
+  std::pair<iterator, bool> insert(const value_type& value);
+  std::pair<iterator, bool> insert(const key_type& key,
+                                   const mapped_type& value);
+  std::pair<iterator, bool> insert_or_assign(const key_type& key,
+                                             const mapped_type& value);
+
+  iterator find(const key_type& key) { return find_key(key); }
+  template <typename Key, typename = detail::transparent_key_t<H, E, Key>>
+  iterator find(const Key& key) {
+    return find_key(key);
+  }
+  bool contains(const key_type& key) const noexcept {
+    return find_index(key, hash_of(key)) != npos;
+  }
+  template <typename Key, typename = detail::transparent_key_t<H, E, Key>>
+  bool contains(const Key& key) const noexcept {
+    return find_index(key, hash_of(key)) != npos;
+  }
+
+ private:
+  using Group = detail::CtrlGroup;
+  static constexpr size_type kGroupWidth = Group::kWidth;
+  static constexpr size_type kMinCapacity = kGroupWidth;
+  static constexpr size_type npos = size_type(-1);
+
+  template <typename Key>
+  static uint64_t hash_of(const Key& key) {
+    return detail::mix_hash(uint64_t(H()(key)));
+  }
+  static int8_t h2(uint64_t hash) noexcept { return int8_t(hash & 0x7F); }
+  size_type home(uint64_t hash) const noexcept {
+    return size_type(hash >> 7) & (capacity_ - 1);
+  }
+
+  // Slot holding key, or npos
+  template <typename Key>
+  size_type find_index(const Key& key, uint64_t hash) const;
+  template <typename Key>
+  iterator find_key(const Key& key);
+  template <typename Key>
+  mapped_type& at_key(const Key& key);
+  template <typename Key>
+  size_type erase_key(const Key& key);
+  // First empty slot on hash's probe sequence
+  size_type find_empty(uint64_t hash) const noexcept;
+  void set_ctrl(size_type i, int8_t ctrl) noexcept;
+  // Constructs a new entry for a key that is known to be absent
+  template <typename... Args>
+  size_type emplace_new(uint64_t hash, Args&&... args);
+  void grow_for_insert();
+  void erase_at(size_type i);
+
+  void allocate(size_type capacity);
+  void destroy_and_free() noexcept;
+  iterator make_iterator(size_type i) noexcept;
+
+  int8_t* ctrl_{};
+  value_type* slots_{};
+  size_type capacity_{};
+  size_type size_{};
+  float max_load_factor_{0.875f};
+};
+
+template <typename K, typename V, typename H, typename E>
+flat_hash_table<K, V, H, E>::flat_hash_table(const flat_hash_table& other)
+    : max_load_factor_(other.max_load_factor_) {
+  if (!other.size_) {
+    return;
+  }
+
+  allocate(other.capacity_);
+  size_type i = 0;
+  try {
+    for (; i < capacity_; ++i) {
+      if (other.ctrl_[i] >= 0) {
+        ::new (static_cast<void*>(slots_ + i)) value_type(other.slots_[i]);
+        ctrl_[i] = other.ctrl_[i];
+      }
+    }
+  } catch (...) {
+    destroy_and_free();
+    throw;
+  }
+  std::memcpy(ctrl_ + capacity_, ctrl_, kGroupWidth);
+  size_ = other.size_;
+}
+
+template <typename K, typename V, typename H, typename E>
+flat_hash_table<K, V, H, E>::flat_hash_table(flat_hash_table&& other) noexcept
+    : ctrl_(other.ctrl_),
+      slots_(other.slots_),
+      capacity_(other.capacity_),
+      size_(other.size_),
+      max_load_factor_(other.max_load_factor_) {
+  other.ctrl_ = nullptr;
+  other.slots_ = nullptr;
+  other.capacity_ = 0;
+  other.size_ = 0;
+}
+
+template <typename K, typename V, typename H, typename E>
+flat_hash_table<K, V, H, E>::~flat_hash_table() {
+  destroy_and_free();
+}
+
+template <typename K, typename V, typename H, typename E>
+flat_hash_table<K, V, H, E>& flat_hash_table<K, V, H, E>::operator=(
+    const flat_hash_table& other) {
+  if (this != &other) {
+    flat_hash_table copy(other);
+    swap(copy);
+  }
+
+  return *this;
+}
+
+template <typename K, typename V, typename H, typename E>
+flat_hash_table<K, V, H, E>& flat_hash_table<K, V, H, E>::operator=(
+    flat_hash_table&& other) noexcept {
+  swap(other);
+
+  return *this;
+}
+
+template <typename K, typename V, typename H, typename E>
+void flat_hash_table<K, V, H, E>::allocate(size_type capacity) {
+  try {
+    ctrl_ = new int8_t[capacity + kGroupWidth];
+    slots_ = std::allocator<value_type>().allocate(capacity);
+  } catch (std::bad_alloc& e) {
+    delete[] ctrl_;
+    ctrl_ = nullptr;
+    throw std::runtime_error("Error: Failed to allocate memory");
+  }
+  std::memset(ctrl_, detail::kCtrlEmpty, capacity + kGroupWidth);
+  capacity_ = capacity;
+}
+
+template <typename K, typename V, typename H, typename E>
+void flat_hash_table<K, V, H, E>::destroy_and_free() noexcept {
+  if (!ctrl_) {
+    return;
+  }
+
+  for (size_type i = 0; i < capacity_; ++i) {
+    if (ctrl_[i] >= 0) {
+      std::destroy_at(slots_ + i);
+    }
+  }
+  std::allocator<value_type>().deallocate(slots_, capacity_);
+  delete[] ctrl_;
+  ctrl_ = nullptr;
+  slots_ = nullptr;
+  capacity_ = 0;
+  size_ = 0;
+}
+
+template <typename K, typename V, typename H, typename E>
+void flat_hash_table<K, V, H, E>::clear() {
+  for (size_type i = 0; i < capacity_; ++i) {
+    if (ctrl_[i] >= 0) {
+      std::destroy_at(slots_ + i);
+    }
+  }
+  if (ctrl_) {
+    std::memset(ctrl_, detail::kCtrlEmpty, capacity_ + kGroupWidth);
+  }
+  size_ = 0;
+}
+
+template <typename K, typename V, typename H, typename E>
+float flat_hash_table<K, V, H, E>::load_factor() const noexcept {
+  return capacity_ ? float(size_) / capacity_ : 0.0f;
+}
+
+template <typename K, typename V, typename H, typename E>
+void flat_hash_table<K, V, H, E>::max_load_factor(float ml) {
+  if (!(ml > 0.0f && ml < 1.0f)) {
+    throw std::invalid_argument("Error: max_load_factor must be in (0, 1)");
+  }
+
+  max_load_factor_ = ml;
+  if (load_factor() > ml) {
+    rehash(0);
+  }
+}
+
+// Moves every entry into a fresh slot array of at least count slots. Types
+// that may throw on move are copied instead, so a failure leaves the table
+// as it was.
+template <typename K, typename V, typename H, typename E>
+void flat_hash_table<K, V, H, E>::rehash(size_type count) {
+  size_type needed = size_type(std::floor(size_ / max_load_factor_)) + 1;
+  count = std::max({count, needed, kMinCapacity});
+  size_type capacity = kMinCapacity;
+  while (capacity < count) {
+    capacity <<= 1;
+  }
+  if (capacity == capacity_) {
+    return;
+  }
+
+  flat_hash_table table;
+  table.max_load_factor_ = max_load_factor_;
+  table.allocate(capacity);
+  for (size_type i = 0; i < capacity_; ++i) {
+    if (ctrl_[i] >= 0) {
+      table.emplace_new(hash_of(slots_[i].first),
+                        std::move_if_noexcept(slots_[i]));
+    }
+  }
+  swap(table);
+}
+
+template <typename K, typename V, typename H, typename E>
+void flat_hash_table<K, V, H, E>::reserve(size_type count) {
+  if (count > size_type(capacity_ * max_load_factor_)) {
+    rehash(size_type(std::ceil(count / max_load_factor_)));
+  }
+}
+
+template <typename K, typename V, typename H, typename E>
+void flat_hash_table<K, V, H, E>::grow_for_insert() {
+  if (size_ + 1 > size_type(capacity_ * max_load_factor_)) {
+    rehash(capacity_ ? capacity_ * 2 : kMinCapacity);
+  }
+}
+
+template <typename K, typename V, typename H, typename E>
+void flat_hash_table<K, V, H, E>::set_ctrl(size_type i, int8_t ctrl) noexcept {
+  ctrl_[i] = ctrl;
+  if (i < kGroupWidth) {
+    ctrl_[capacity_ + i] = ctrl;
+  }
+}
+
+template <typename K, typename V, typename H, typename E>
+template <typename Key>
+typename flat_hash_table<K, V, H, E>::size_type
+flat_hash_table<K, V, H, E>::find_index(const Key& key, uint64_t hash) const {
+  if (!capacity_) {
+    return npos;
+  }
+
+  size_type mask = capacity_ - 1;
+  for (size_type pos = home(hash);; pos = (pos + kGroupWidth) & mask) {
+    Group group(ctrl_ + pos);
+    for (uint32_t match = group.match(h2(hash)); match; match &= match - 1) {
+      size_type i = (pos + __builtin_ctz(match)) & mask;
+      if (E()(slots_[i].first, key)) {
+        return i;
+      }
+    }
+    if (group.match_empty()) {
+      return npos;
+    }
+  }
+}
+
+template <typename K, typename V, typename H, typename E>
+typename flat_hash_table<K, V, H, E>::size_type
+flat_hash_table<K, V, H, E>::find_empty(uint64_t hash) const noexcept {
+  size_type mask = capacity_ - 1;
+  for (size_type pos = home(hash);; pos = (pos + kGroupWidth) & mask) {
+    uint32_t empty = Group(ctrl_ + pos).match_empty();
+    if (empty) {
+      return (pos + __builtin_ctz(empty)) & mask;
+    }
+  }
+}
+
+template <typename K, typename V, typename H, typename E>
+template <typename... Args>
+typename flat_hash_table<K, V, H, E>::size_type
+flat_hash_table<K, V, H, E>::emplace_new(uint64_t hash, Args&&... args) {
+  size_type i = find_empty(hash);
+  ::new (static_cast<void*>(slots_ + i))
+      value_type(std::forward<Args>(args)...);
+  set_ctrl(i, h2(hash));
+  ++size_;
+
+  return i;
+}
+
+// Backward-shift deletion: walk the rest of the cluster and pull each entry
+// whose home slot is not between the hole and its current slot into the
+// hole, so no entry ends up behind an empty slot on its probe sequence.
+// The hole keeps a live (moved-from) entry until the end, so if H or a move
+// assignment throws, the hole is simply emptied: nothing leaks and the
+// erased entry is gone, but entries further along the cluster may not be
+// found again until the next rehash.
+template <typename K, typename V, typename H, typename E>
+void flat_hash_table<K, V, H, E>::erase_at(size_type i) {
+  size_type mask = capacity_ - 1;
+  try {
+    for (size_type j = (i + 1) & mask; ctrl_[j] >= 0; j = (j + 1) & mask) {
+      size_type h = home(hash_of(slots_[j].first));
+      if (((j - h) & mask) >= ((j - i) & mask)) {
+        slots_[i] = std::move(slots_[j]);
+        set_ctrl(i, ctrl_[j]);
+        i = j;
+      }
+    }
+  } catch (...) {
+    std::destroy_at(slots_ + i);
+    set_ctrl(i, detail::kCtrlEmpty);
+    --size_;
+    throw;
+  }
+  std::destroy_at(slots_ + i);
+  set_ctrl(i, detail::kCtrlEmpty);
+  --size_;
+}
+
+template <typename K, typename V, typename H, typename E>
+typename flat_hash_table<K, V, H, E>::iterator
+flat_hash_table<K, V, H, E>::make_iterator(size_type i) noexcept {
+  return iterator{ctrl_ + i, ctrl_ + capacity_, slots_ + i};
+}
+
+template <typename K, typename V, typename H, typename E>
+typename flat_hash_table<K, V, H, E>::iterator
+flat_hash_table<K, V, H, E>::begin() {
+  size_type i = 0;
+  while (i < capacity_ && ctrl_[i] < 0) {
+    ++i;
+  }
+
+  return make_iterator(i);
+}
+
+template <typename K, typename V, typename H, typename E>
+typename flat_hash_table<K, V, H, E>::iterator
+flat_hash_table<K, V, H, E>::end() {
+  return make_iterator(capacity_);
+}
+
+template <typename K, typename V, typename H, typename E>
+typename flat_hash_table<K, V, H, E>::const_iterator
+flat_hash_table<K, V, H, E>::begin() const {
+  size_type i = 0;
+  while (i < capacity_ && ctrl_[i] < 0) {
+    ++i;
+  }
+
+  return const_iterator{ctrl_ + i, ctrl_ + capacity_, slots_ + i};
+}
+
+template <typename K, typename V, typename H, typename E>
+typename flat_hash_table<K, V, H, E>::const_iterator
+flat_hash_table<K, V, H, E>::end() const {
+  return const_iterator{ctrl_ + capacity_, ctrl_ + capacity_,
+                        slots_ + capacity_};
+}
+
+template <typename K, typename V, typename H, typename E>
+template <typename Key>
+typename flat_hash_table<K, V, H, E>::iterator
+flat_hash_table<K, V, H, E>::find_key(const Key& key) {
+  size_type i = find_index(key, hash_of(key));
+
+  return i == npos ? end() : make_iterator(i);
+}
+
+template <typename K, typename V, typename H, typename E>
+template <typename Key>
+typename flat_hash_table<K, V, H, E>::mapped_type&
+flat_hash_table<K, V, H, E>::at_key(const Key& key) {
+  size_type i = find_index(key, hash_of(key));
+  if (i == npos) {
+    throw std::out_of_range("Error: key doesn't exist");
+  }
+
+  return slots_[i].second;
+}
+
+template <typename K, typename V, typename H, typename E>
+typename flat_hash_table<K, V, H, E>::mapped_type&
+flat_hash_table<K, V, H, E>::operator[](const key_type& key) {
+  uint64_t hash = hash_of(key);
+  size_type i = find_index(key, hash);
+  if (i == npos) {
+    grow_for_insert();
+    i = emplace_new(hash, key, mapped_type{});
+  }
+
+  return slots_[i].second;
+}
+
+template <typename K, typename V, typename H, typename E>
+std::pair<typename flat_hash_table<K, V, H, E>::iterator, bool>
+flat_hash_table<K, V, H, E>::insert(const value_type& value) {
+  uint64_t hash = hash_of(value.first);
+  size_type i = find_index(value.first, hash);
+  if (i != npos) {
+    return std::make_pair(make_iterator(i), false);
+  }
+
+  grow_for_insert();
+  return std::make_pair(make_iterator(emplace_new(hash, value)), true);
+}
+
+template <typename K, typename V, typename H, typename E>
+std::pair<typename flat_hash_table<K, V, H, E>::iterator, bool>
+flat_hash_table<K, V, H, E>::insert(const key_type& key,
+                                 const mapped_type& value) {
+  return insert(std::make_pair(key, value));
+}
+
+template <typename K, typename V, typename H, typename E>
+std::pair<typename flat_hash_table<K, V, H, E>::iterator, bool>
+flat_hash_table<K, V, H, E>::insert_or_assign(const key_type& key,
+                                           const mapped_type& value) {
+  std::pair<iterator, bool> it = insert(key, value);
+  if (!it.second) {
+    it.first->second = value;
+  }
+
+  return it;
+}
+
+// Reserves room for every argument up front, so inserting the later ones
+// does not rehash and invalidate the iterators returned for the earlier ones
+template <typename K, typename V, typename H, typename E>
+template <typename... Args>
+s21::Vector<std::pair<typename flat_hash_table<K, V, H, E>::iterator, bool>>
+flat_hash_table<K, V, H, E>::insert_many(Args&&... args) {
+  reserve(size_ + sizeof...(args));
+  return {insert(std::forward<Args>(args))...};
+}
+
+template <typename K, typename V, typename H, typename E>
+void flat_hash_table<K, V, H, E>::erase(iterator pos) {
+  if (pos == end()) {
+    throw std::out_of_range("Error: attempt to access beyond map");
+  }
+
+  erase_at(size_type(pos.slot_ - slots_));
+}
+
+template <typename K, typename V, typename H, typename E>
+template <typename Key>
+typename flat_hash_table<K, V, H, E>::size_type
+flat_hash_table<K, V, H, E>::erase_key(const Key& key) {
+  size_type i = find_index(key, hash_of(key));
+  if (i == npos) {
+    return 0;
+  }
+
+  erase_at(i);
+  return 1;
+}
+
+template <typename K, typename V, typename H, typename E>
+void flat_hash_table<K, V, H, E>::swap(flat_hash_table& other) noexcept {
+  std::swap(ctrl_, other.ctrl_);
+  std::swap(slots_, other.slots_);
+  std::swap(capacity_, other.capacity_);
+  std::swap(size_, other.size_);
+  std::swap(max_load_factor_, other.max_load_factor_);
+}
+
+}  // namespace s21
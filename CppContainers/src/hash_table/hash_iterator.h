@@ -5,20 +5,33 @@
 
 namespace s21 {
 
-template <typename, typename, typename>
+template <typename, typename, typename, typename, typename>
 class hash_table;
 
+// Bucket entry of hash_table: the element plus the full hash of its key, so
+// lookups skip entries whose hash differs without comparing keys and
+// rehashing never calls the hasher again
+template <typename K, typename V>
+struct hash_entry {
+  hash_entry(const std::pair<K, V>& value, size_t hash)
+      : value(value), hash(hash) {}
+
+  std::pair<K, V> value;
+  size_t hash;
+};
+
 template <typename K, typename V>
 class base_hash_iterator {
  public:
-  friend class hash_table<K, V, std::hash<K>>;
+  template <typename, typename, typename, typename, typename>
+  friend class hash_table;
   using key_type = K;
   using mapped_type = std::remove_const_t<V>;
   using value_type = std::pair<key_type, mapped_type>;
   using reference = value_type&;
   using pointer = value_type*;
   using iterator_category = std::forward_iterator_tag;
-  using bucket = List<value_type>;
+  using bucket = List<hash_entry<key_type, mapped_type>>;
   using table_it = typename Vector<bucket>::iterator;
   using bucket_it = typename bucket::iterator;
 
@@ -28,8 +41,8 @@ class base_hash_iterator {
   base_hash_iterator& operator=(const base_hash_iterator& other) = default;
   base_hash_iterator& operator=(base_hash_iterator&& other) = default;
 
-  reference operator*() { return *b_; }
-  pointer operator->() { return &(*b_); }
+  reference operator*() { return b_->value; }
+  pointer operator->() { return &b_->value; }
 
   bucket_it get_bucket_it() { return b_; }
 
@@ -42,8 +55,7 @@ class base_hash_iterator {
       throw std::out_of_range("Error: attempt to access beyond map");
     }
 
-    if (b_ != begin_->end()) {
-      ++b_;
+    if (++b_ != begin_->end()) {
       return;
     }
     ++begin_;
@@ -56,10 +68,9 @@ class base_hash_iterator {
     }
   }
 
+  // Past-the-end iterators only compare their bucket position
   bool equals(const base_hash_iterator& other) const {
-    if (begin_ == other.begin_ && end_ == other.end_) return true;
-
-    return b_ == other.b_;
+    return begin_ == other.begin_ && (begin_ == end_ || b_ == other.b_);
   }
 
   table_it begin_;
@@ -70,7 +81,8 @@ class base_hash_iterator {
 template <typename K, typename V>
 class hash_iterator : public base_hash_iterator<K, V> {
  public:
-  friend class hash_table<K, V, std::hash<K>>;
+  template <typename, typename, typename, typename, typename>
+  friend class hash_table;
   using base = base_hash_iterator<K, V>;
   using key_type = typename base::key_type;
   using mapped_type = typename base::mapped_type;
@@ -111,7 +123,8 @@ class hash_iterator : public base_hash_iterator<K, V> {
 template <typename K, typename V>
 class const_hash_iterator : public base_hash_iterator<K, const V> {
  public:
-  friend class hash_table<K, V, std::hash<K>>;
+  template <typename, typename, typename, typename, typename>
+  friend class hash_table;
   using base = base_hash_iterator<K, const V>;
   using key_type = typename base::key_type;
   using mapped_type = typename base::mapped_type;
@@ -1,37 +1,64 @@
 #pragma once
 
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
 #include "s21_list.h"
 #include "s21_vector.h"
 #include "hash_iterator.h"
+#include "hash_traits.h"
 
 namespace s21 {
 
-template <typename K, typename V, typename H = std::hash<K>>
+// Separate chaining: a Vector of List buckets. E compares keys and B is the
+// bucket policy (ModuloBuckets or PowerOfTwoBuckets) that maps hashes to
+// buckets.
+template <typename K, typename V, typename H = std::hash<K>,
+          typename E = detail::default_key_equal_t<H, K>,
+          typename B = ModuloBuckets>
 class hash_table {
  public:
   using key_type = K;
   using mapped_type = V;
   using value_type = std::pair<key_type, mapped_type>;
-  using bucket = List<value_type>;
+  using bucket = List<hash_entry<key_type, mapped_type>>;
   using reference = value_type&;
   using const_reference = const value_type&;
   using iterator = hash_iterator<key_type, mapped_type>;
   using const_iterator = const_hash_iterator<key_type, mapped_type>;
   using size_type = size_t;
-
-  hash_table() : table_(defualt_capacity) {}
-  hash_table(const hash_table& other) = default;
-  hash_table(hash_table&& other) = default;
+  using hasher = H;
+  using key_equal = E;
+  using bucket_policy = B;
+
+  hash_table() : table_(B::count(defualt_capacity)) {}
+  // The copy's buckets share one node pool, as after rehash()
+  hash_table(const hash_table& other);
+  // Leaves other without buckets; the next insert gives it new ones
+  hash_table(hash_table&& other) noexcept;
   ~hash_table() = default;
 
-  hash_table<K, V>& operator=(const hash_table& other) = default;
-  hash_table<K, V>& operator=(hash_table&& other) = default;
+  hash_table<K, V, H, E, B>& operator=(const hash_table& other);
+  hash_table<K, V, H, E, B>& operator=(hash_table&& other) noexcept;
 
   size_type size() const noexcept;
+  // Same as bucket_count()
   size_type capacity() const noexcept;
   bool empty() const noexcept;
+  // Frees every entry's node and keeps bucket_count()
   void clear();
 
+  size_type bucket_count() const noexcept;
+  float load_factor() const noexcept;
+  float max_load_factor() const noexcept;
+  void max_load_factor(float ml);
+  // Redistributes every entry over max(count, size() / max_load_factor())
+  // buckets by relinking nodes, without copying or allocating entries
+  void rehash(size_type count);
+  // Makes room for count entries without exceeding max_load_factor()
+  void reserve(size_type count);
+
   iterator begin();
   iterator end();
   const_iterator begin() const;
@@ -39,10 +66,22 @@ class hash_table {
   const_iterator cbegin() const;
   const_iterator cend() const;
 
-  mapped_type& at(const key_type& key);
+  // at, erase(key), find and contains also take any Key that H hashes and
+  // E compares with key_type when both declare is_transparent
+  mapped_type& at(const key_type& key) { return at_key(key); }
+  template <typename Key, typename = detail::transparent_key_t<H, E, Key>>
+  mapped_type& at(const Key& key) {
+    return at_key(key);
+  }
   mapped_type& operator[](const key_type& key);
 
   void erase(iterator pos);
+  // Returns the number of erased entries, 0 or 1
+  size_type erase(const key_type& key) { return erase_key(key); }
+  template <typename Key, typename = detail::transparent_key_t<H, E, Key>>
+  size_type erase(const Key& key) {
+    return erase_key(key);
+  }
   void swap(hash_table& other);
   void assign(value_type& value);
 
@@ -54,260 +93,498 @@ class hash_table {
   std::pair<iterator, bool> insert_or_assign(const key_type& key,
                                              const mapped_type& value);
 
-  iterator find(const key_type& key);
-  bool contains(const key_type& key) const noexcept;
+  iterator find(const key_type& key) { return find_key<iterator>(key); }
+  const_iterator find(const key_type& key) const {
+    return find_key<const_iterator>(key);
+  }
+  template <typename Key, typename = detail::transparent_key_t<H, E, Key>>
+  iterator find(const Key& key) {
+    return find_key<iterator>(key);
+  }
+  template <typename Key, typename = detail::transparent_key_t<H, E, Key>>
+  const_iterator find(const Key& key) const {
+    return find_key<const_iterator>(key);
+  }
+  bool contains(const key_type& key) const noexcept {
+    return contains_key(key);
+  }
+  template <typename Key, typename = detail::transparent_key_t<H, E, Key>>
+  bool contains(const Key& key) const noexcept {
+    return contains_key(key);
+  }
 
  protected:
-  int compute_hash(const key_type& key) const noexcept {
-    return hash_function(key);
+  template <typename Key>
+  size_type compute_hash(const Key& key) const noexcept {
+    return H()(key);
+  }
+  size_type bucket_index(size_type hash) const noexcept {
+    return B::index(hash, table_.size());
   }
-  void resize() { table_.reserve(table_.capacity()); }
-  bool exceeds_limit(double load_limit = 0.7) {
-    load_factor = (double)size() / capacity();
-    return std::abs(load_factor - load_limit) >
-           std::numeric_limits<double>::epsilon();
+  // Entry holding key within b, or b.end(). Keys are only compared when
+  // the cached hashes match.
+  template <typename Bucket, typename Key>
+  static auto find_in_bucket(Bucket& b, const Key& key, size_type hash) {
+    auto it = b.begin();
+    while (it != b.end() && !(it->hash == hash && E()(it->value.first, key))) {
+      ++it;
+    }
+    return it;
   }
+  // Doubles the bucket count when one more entry would exceed the limit
+  void grow_for_insert();
+  // Points every bucket of table at anchor's node pool, so the entries of
+  // the whole table come from one set of large slabs
+  static void share_pools(Vector<bucket>& table, bucket& anchor);
+  // Keep first_ and last_ current after an entry is added to or removed
+  // from bucket index; size_ must already be updated
+  void note_insert(size_type index) noexcept;
+  void note_erase(size_type index) noexcept;
 
  private:
-  int hash_function(const key_type& key) const noexcept {
-    return H()(key) % table_.capacity();
-  }
+  template <typename It, typename Key>
+  It find_key(const Key& key) const;
+  template <typename Key>
+  bool contains_key(const Key& key) const noexcept;
+  template <typename Key>
+  mapped_type& at_key(const Key& key);
+  template <typename Key>
+  size_type erase_key(const Key& key);
+
+  template <typename It>
+  It make_begin() const;
+  template <typename It>
+  It make_end() const;
 
   constexpr static int defualt_capacity = 10;
   size_type size_{};
-  double load_factor{};
+  float max_load_factor_{1.0f};
+  // First and last non-empty buckets, meaningful while size_ is non-zero,
+  // so begin() and end() are O(1)
+  size_type first_{};
+  size_type last_{};
   Vector<bucket> table_;
 };
 
-template <typename K, typename V, typename H>
-typename hash_table<K, V, H>::size_type hash_table<K, V, H>::size()
+template <typename K, typename V, typename H, typename E, typename B>
+hash_table<K, V, H, E, B>::hash_table(const hash_table& other)
+    : size_(other.size_),
+      max_load_factor_(other.max_load_factor_),
+      first_(other.first_),
+      last_(other.last_),
+      table_(other.table_.size()) {
+  if (!size_) {
+    return;
+  }
+
+  share_pools(table_, table_[first_]);
+  for (size_type i = first_; i <= last_; ++i) {
+    for (auto& entry : other.table_[i]) {
+      table_[i].push_back(entry);
+    }
+  }
+}
+
+template <typename K, typename V, typename H, typename E, typename B>
+hash_table<K, V, H, E, B>::hash_table(hash_table&& other) noexcept
+    : size_(other.size_),
+      max_load_factor_(other.max_load_factor_),
+      first_(other.first_),
+      last_(other.last_),
+      table_(std::move(other.table_)) {
+  other.size_ = 0;
+}
+
+template <typename K, typename V, typename H, typename E, typename B>
+hash_table<K, V, H, E, B>& hash_table<K, V, H, E, B>::operator=(
+    const hash_table& other) {
+  if (this != &other) {
+    hash_table copy(other);
+    swap(copy);
+  }
+
+  return *this;
+}
+
+template <typename K, typename V, typename H, typename E, typename B>
+hash_table<K, V, H, E, B>& hash_table<K, V, H, E, B>::operator=(
+    hash_table&& other) noexcept {
+  swap(other);
+
+  return *this;
+}
+
+template <typename K, typename V, typename H, typename E, typename B>
+typename hash_table<K, V, H, E, B>::size_type hash_table<K, V, H, E, B>::size()
     const noexcept {
   return size_;
 }
 
-template <typename K, typename V, typename H>
-typename hash_table<K, V, H>::size_type hash_table<K, V, H>::capacity()
-    const noexcept {
-  return table_.capacity();
+template <typename K, typename V, typename H, typename E, typename B>
+typename hash_table<K, V, H, E, B>::size_type
+hash_table<K, V, H, E, B>::capacity() const noexcept {
+  return bucket_count();
 }
 
-template <typename K, typename V, typename H>
-bool hash_table<K, V, H>::empty() const noexcept {
-  return !size();
+template <typename K, typename V, typename H, typename E, typename B>
+typename hash_table<K, V, H, E, B>::size_type
+hash_table<K, V, H, E, B>::bucket_count() const noexcept {
+  return table_.size();
 }
 
-template <typename K, typename V, typename H>
-void hash_table<K, V, H>::clear() {
-  table_.clear();
+template <typename K, typename V, typename H, typename E, typename B>
+float hash_table<K, V, H, E, B>::load_factor() const noexcept {
+  return table_.empty() ? 0.0f : float(size_) / table_.size();
 }
 
-template <typename K, typename V, typename H>
-bool hash_table<K, V, H>::contains(const key_type& key) const noexcept {
-  int hash = compute_hash(key);
-  auto& bucket = table_[hash];
+template <typename K, typename V, typename H, typename E, typename B>
+float hash_table<K, V, H, E, B>::max_load_factor() const noexcept {
+  return max_load_factor_;
+}
 
-  for (auto& it : bucket) {
-    if (it.first == key) {
-      return true;
-    }
+template <typename K, typename V, typename H, typename E, typename B>
+void hash_table<K, V, H, E, B>::max_load_factor(float ml) {
+  if (!(ml > 0.0f)) {
+    throw std::invalid_argument("Error: max_load_factor must be positive");
   }
 
-  return false;
+  max_load_factor_ = ml;
+  if (load_factor() > ml) {
+    rehash(0);
+  }
 }
 
-template <typename K, typename V, typename H>
-typename hash_table<K, V, H>::iterator hash_table<K, V, H>::find(
-    const key_type& key) {
-  int hash = compute_hash(key);
-  auto& bucket = table_[hash];
+template <typename K, typename V, typename H, typename E, typename B>
+void hash_table<K, V, H, E, B>::rehash(size_type count) {
+  size_type needed = size_type(std::ceil(size_ / max_load_factor_));
+  count = B::count(std::max({count, needed, size_type(1)}));
+  if (count == table_.size()) {
+    return;
+  }
 
-  for (auto it = bucket.begin(); it != bucket.end(); ++it) {
-    if (it->first == key) {
-      return iterator{table_.begin() + hash, table_.end(), it};
+  Vector<bucket> table(count);
+  share_pools(table, size_ ? table_[first_] : table[0]);
+  size_type first = count;
+  size_type last = 0;
+  for (auto& old : table_) {
+    while (!old.empty()) {
+      size_type index = B::index(old.front().hash, count);
+      table[index].splice(table[index].end(), old, old.begin());
+      first = std::min(first, index);
+      last = std::max(last, index);
     }
   }
+  table_.swap(table);
+  first_ = first;
+  last_ = last;
+}
 
-  return end();
+template <typename K, typename V, typename H, typename E, typename B>
+void hash_table<K, V, H, E, B>::share_pools(Vector<bucket>& table,
+                                            bucket& anchor) {
+  for (auto& b : table) {
+    b.share_pool(anchor);
+  }
 }
 
-template <typename K, typename V, typename H>
-typename hash_table<K, V, H>::iterator hash_table<K, V, H>::begin() {
-  for (auto it = table_.begin(); it != table_.end(); ++it) {
-    if (!it->empty()) {
-      return iterator{it, table_.end(), it->begin()};
-    }
+template <typename K, typename V, typename H, typename E, typename B>
+void hash_table<K, V, H, E, B>::reserve(size_type count) {
+  rehash(size_type(std::ceil(count / max_load_factor_)));
+}
+
+template <typename K, typename V, typename H, typename E, typename B>
+void hash_table<K, V, H, E, B>::grow_for_insert() {
+  if (table_.empty()) {
+    rehash(B::count(defualt_capacity));
+  } else if (size_ + 1 > table_.size() * max_load_factor_) {
+    rehash(table_.size() * 2);
   }
+}
 
-  return end();
+template <typename K, typename V, typename H, typename E, typename B>
+bool hash_table<K, V, H, E, B>::empty() const noexcept {
+  return !size();
 }
 
-template <typename K, typename V, typename H>
-typename hash_table<K, V, H>::iterator hash_table<K, V, H>::end() {
-  auto it = table_.end() - 1;
-  for (; it >= table_.begin(); --it) {
-    if (!it->empty()) {
-      return iterator{table_.end(), table_.end(), it->end()};
-    }
+// Buckets that share a pool only hand their nodes back to it, so the old
+// buckets are dropped together, which frees the slabs, and replaced by as
+// many new ones
+template <typename K, typename V, typename H, typename E, typename B>
+void hash_table<K, V, H, E, B>::clear() {
+  Vector<bucket> table(table_.size());
+  if (!table.empty()) {
+    share_pools(table, table[0]);
+  }
+  table_.swap(table);
+  size_ = 0;
+}
+
+template <typename K, typename V, typename H, typename E, typename B>
+template <typename Key>
+bool hash_table<K, V, H, E, B>::contains_key(const Key& key) const noexcept {
+  if (table_.empty()) {
+    return false;
   }
 
-  return iterator{table_.end(), table_.end(), it->end()};
+  size_type hash = compute_hash(key);
+  auto& bucket = table_[bucket_index(hash)];
+
+  return find_in_bucket(bucket, key, hash) != bucket.end();
 }
 
-template <typename K, typename V, typename H>
-typename hash_table<K, V, H>::const_iterator hash_table<K, V, H>::begin()
-    const {
-  for (auto it = table_.begin(); it != table_.end(); ++it) {
-    if (!it->empty()) {
-      return const_iterator{it, table_.end(), it->begin()};
-    }
+// Builds either iterator kind the way make_begin() does
+template <typename K, typename V, typename H, typename E, typename B>
+template <typename It, typename Key>
+It hash_table<K, V, H, E, B>::find_key(const Key& key) const {
+  if (table_.empty()) {
+    return make_end<It>();
+  }
+
+  auto& table = const_cast<Vector<bucket>&>(table_);
+  size_type hash = compute_hash(key);
+  size_type index = bucket_index(hash);
+  auto& bucket = table[index];
+  auto it = find_in_bucket(bucket, key, hash);
+  if (it != bucket.end()) {
+    return It{table.begin() + index, table.end(), it};
   }
 
-  return end();
+  return make_end<It>();
 }
 
-template <typename K, typename V, typename H>
-typename hash_table<K, V, H>::const_iterator hash_table<K, V, H>::end() const {
-  auto it = table_.end() - 1;
-  for (; it >= table_.begin(); --it) {
-    if (!it->empty()) {
-      return const_iterator{table_.end(), table_.end(), it->end()};
-    }
+template <typename K, typename V, typename H, typename E, typename B>
+typename hash_table<K, V, H, E, B>::iterator
+hash_table<K, V, H, E, B>::begin() {
+  return make_begin<iterator>();
+}
+
+template <typename K, typename V, typename H, typename E, typename B>
+typename hash_table<K, V, H, E, B>::iterator hash_table<K, V, H, E, B>::end() {
+  return make_end<iterator>();
+}
+
+template <typename K, typename V, typename H, typename E, typename B>
+typename hash_table<K, V, H, E, B>::const_iterator
+hash_table<K, V, H, E, B>::begin() const {
+  return make_begin<const_iterator>();
+}
+
+template <typename K, typename V, typename H, typename E, typename B>
+typename hash_table<K, V, H, E, B>::const_iterator
+hash_table<K, V, H, E, B>::end() const {
+  return make_end<const_iterator>();
+}
+
+template <typename K, typename V, typename H, typename E, typename B>
+typename hash_table<K, V, H, E, B>::const_iterator
+hash_table<K, V, H, E, B>::cbegin() const {
+  return make_begin<const_iterator>();
+}
+
+template <typename K, typename V, typename H, typename E, typename B>
+typename hash_table<K, V, H, E, B>::const_iterator
+hash_table<K, V, H, E, B>::cend() const {
+  return make_end<const_iterator>();
+}
+
+// Both iterator kinds walk the same bucket layout; a const_iterator only
+// promises not to be used for writes
+template <typename K, typename V, typename H, typename E, typename B>
+template <typename It>
+It hash_table<K, V, H, E, B>::make_begin() const {
+  auto& table = const_cast<Vector<bucket>&>(table_);
+  if (!size_) {
+    return make_end<It>();
   }
 
-  return const_iterator{table_.end(), table_.end(), it->end()};
+  return It{table.begin() + first_, table.end(), table[first_].begin()};
 }
 
-template <typename K, typename V, typename H>
-typename hash_table<K, V, H>::const_iterator hash_table<K, V, H>::cbegin()
-    const {
-  for (auto it = table_.begin(); it != table_.end(); ++it) {
-    if (!it->empty()) {
-      return const_iterator{it, table_.end(), it->begin()};
-    }
+// Past-the-end iterators keep pointing at the last element
+template <typename K, typename V, typename H, typename E, typename B>
+template <typename It>
+It hash_table<K, V, H, E, B>::make_end() const {
+  auto& table = const_cast<Vector<bucket>&>(table_);
+  if (!size_) {
+    return It{table.end(), table.end(), {}};
   }
 
-  return end();
+  return It{table.end(), table.end(), --table[last_].end()};
 }
 
-template <typename K, typename V, typename H>
-typename hash_table<K, V, H>::const_iterator hash_table<K, V, H>::cend() const {
-  auto it = table_.end() - 1;
-  for (; it >= table_.begin(); --it) {
-    if (!it->empty()) {
-      return const_iterator{table_.end(), table_.end(), it->end()};
-    }
+template <typename K, typename V, typename H, typename E, typename B>
+void hash_table<K, V, H, E, B>::note_insert(size_type index) noexcept {
+  if (size_ == 1) {
+    first_ = last_ = index;
+  } else {
+    first_ = std::min(first_, index);
+    last_ = std::max(last_, index);
   }
+}
 
-  return const_iterator{table_.end(), table_.end(), it->end()};
+// Only erasing the last entry of the first or last occupied bucket has to
+// look for the next one, so erasing everything costs O(buckets) in total
+template <typename K, typename V, typename H, typename E, typename B>
+void hash_table<K, V, H, E, B>::note_erase(size_type index) noexcept {
+  if (!size_ || !table_[index].empty()) {
+    return;
+  }
+
+  while (table_[first_].empty()) {
+    ++first_;
+  }
+  while (table_[last_].empty()) {
+    --last_;
+  }
 }
 
-template <typename K, typename V, typename H>
-void hash_table<K, V, H>::assign(value_type& value) {
-  int hash = compute_hash(value.first);
-  auto& bucket = table_[hash];
+template <typename K, typename V, typename H, typename E, typename B>
+void hash_table<K, V, H, E, B>::assign(value_type& value) {
+  if (table_.empty()) {
+    return;
+  }
 
-  for (auto& it : bucket) {
-    if (it.first == value.first) {
-      it.second = value.second;
-      return;
-    }
+  size_type hash = compute_hash(value.first);
+  auto& bucket = table_[bucket_index(hash)];
+  auto it = find_in_bucket(bucket, value.first, hash);
+  if (it != bucket.end()) {
+    it->value.second = value.second;
   }
 }
 
-template <typename K, typename V, typename H>
+template <typename K, typename V, typename H, typename E, typename B>
 template <typename... Args>
-s21::Vector<std::pair<typename hash_table<K, V, H>::iterator, bool>>
-hash_table<K, V, H>::insert_many(Args&&... args) {
+s21::Vector<std::pair<typename hash_table<K, V, H, E, B>::iterator, bool>>
+hash_table<K, V, H, E, B>::insert_many(Args&&... args) {
+  // Growing midway would leave the iterators returned so far pointing at
+  // the old buckets
+  reserve(size_ + sizeof...(args));
   return {insert(std::forward<Args>(args))...};
 }
 
-template <typename K, typename V, typename H>
-std::pair<typename hash_table<K, V, H>::iterator, bool>
-hash_table<K, V, H>::insert(const value_type& value) {
-  if (exceeds_limit()) {
-    resize();
-  }
-
-  int hash = compute_hash(value.first);
-  auto& bucket = table_[hash];
-  for (auto it = bucket.begin(); it != bucket.end(); ++it) {
-    if (it->first == value.first) {
-      return std::make_pair(iterator(table_.begin() + hash, table_.end(), it),
-                            false);
+template <typename K, typename V, typename H, typename E, typename B>
+std::pair<typename hash_table<K, V, H, E, B>::iterator, bool>
+hash_table<K, V, H, E, B>::insert(const value_type& value) {
+  size_type hash = compute_hash(value.first);
+  if (!table_.empty()) {
+    size_type index = bucket_index(hash);
+    auto& bucket = table_[index];
+    auto it = find_in_bucket(bucket, value.first, hash);
+    if (it != bucket.end()) {
+      return std::make_pair(
+          iterator(table_.begin() + index, table_.end(), it), false);
     }
   }
 
-  bucket.push_back(value);
+  grow_for_insert();
+  size_type index = bucket_index(hash);
+  auto& bucket = table_[index];
+  bucket.emplace_back(value, hash);
   ++size_;
+  note_insert(index);
 
   return std::make_pair(
-      iterator(table_.begin() + hash, table_.end(), bucket.end()), true);
+      iterator(table_.begin() + index, table_.end(), --bucket.end()), true);
 }
 
-template <typename K, typename V, typename H>
-std::pair<typename hash_table<K, V, H>::iterator, bool>
-hash_table<K, V, H>::insert(const key_type& key, const mapped_type& value) {
+template <typename K, typename V, typename H, typename E, typename B>
+std::pair<typename hash_table<K, V, H, E, B>::iterator, bool>
+hash_table<K, V, H, E, B>::insert(const key_type& key,
+                                  const mapped_type& value) {
   std::pair<iterator, bool> it = insert(std::make_pair(key, value));
   return it;
 }
 
-template <typename K, typename V, typename H>
-std::pair<typename hash_table<K, V, H>::iterator, bool>
-hash_table<K, V, H>::insert_or_assign(const key_type& key,
-                                      const mapped_type& value) {
-  value_type p = std::make_pair(key, value);
-  std::pair<iterator, bool> it = insert(p);
+template <typename K, typename V, typename H, typename E, typename B>
+std::pair<typename hash_table<K, V, H, E, B>::iterator, bool>
+hash_table<K, V, H, E, B>::insert_or_assign(const key_type& key,
+                                            const mapped_type& value) {
+  std::pair<iterator, bool> it = insert(key, value);
 
   if (!it.second) {
-    assign(p);
+    it.first->second = value;
   }
 
   return it;
 }
 
-template <typename K, typename V, typename H>
-typename hash_table<K, V, H>::mapped_type& hash_table<K, V, H>::operator[](
-    const key_type& key) {
-  int hash = compute_hash(key);
-  auto& bucket = table_[hash];
-
-  for (auto& it : bucket) {
-    if (it.first == key) {
-      return it.second;
+template <typename K, typename V, typename H, typename E, typename B>
+typename hash_table<K, V, H, E, B>::mapped_type&
+hash_table<K, V, H, E, B>::operator[](const key_type& key) {
+  size_type hash = compute_hash(key);
+  if (!table_.empty()) {
+    auto& bucket = table_[bucket_index(hash)];
+    auto it = find_in_bucket(bucket, key, hash);
+    if (it != bucket.end()) {
+      return it->value.second;
     }
   }
-  if (exceeds_limit()) {
-    resize();
-  }
-  bucket.push_back(std::make_pair(key, mapped_type{}));
+
+  grow_for_insert();
+  size_type index = bucket_index(hash);
+  auto& bucket = table_[index];
+  bucket.emplace_back(std::make_pair(key, mapped_type{}), hash);
   ++size_;
+  note_insert(index);
 
-  return bucket.end()->second;
+  return bucket.back().value.second;
 }
 
-template <typename K, typename V, typename H>
-typename hash_table<K, V, H>::mapped_type& hash_table<K, V, H>::at(
-    const key_type& key) {
-  if (!contains(key)) {
-    throw std::out_of_range("Error: key doesn't exist");
+template <typename K, typename V, typename H, typename E, typename B>
+template <typename Key>
+typename hash_table<K, V, H, E, B>::mapped_type&
+hash_table<K, V, H, E, B>::at_key(const Key& key) {
+  if (!table_.empty()) {
+    size_type hash = compute_hash(key);
+    auto& bucket = table_[bucket_index(hash)];
+    auto it = find_in_bucket(bucket, key, hash);
+    if (it != bucket.end()) {
+      return it->value.second;
+    }
   }
 
-  return (*this)[key];
+  throw std::out_of_range("Error: key doesn't exist");
 }
 
-template <typename K, typename V, typename H>
-void hash_table<K, V, H>::swap(hash_table& other) {
+template <typename K, typename V, typename H, typename E, typename B>
+void hash_table<K, V, H, E, B>::swap(hash_table& other) {
   table_.swap(other.table_);
+  std::swap(size_, other.size_);
+  std::swap(max_load_factor_, other.max_load_factor_);
+  std::swap(first_, other.first_);
+  std::swap(last_, other.last_);
 }
 
-template <typename K, typename V, typename H>
-void hash_table<K, V, H>::erase(iterator pos) {
-  int hash = pos->first;
-  auto& bucket = table_[hash];
-
+template <typename K, typename V, typename H, typename E, typename B>
+void hash_table<K, V, H, E, B>::erase(iterator pos) {
   typename bucket::iterator b = pos.get_bucket_it();
-  bucket.erase(b);
+  size_type index = bucket_index(b->hash);
+  table_[index].erase(b);
+  --size_;
+  note_erase(index);
+}
+
+template <typename K, typename V, typename H, typename E, typename B>
+template <typename Key>
+typename hash_table<K, V, H, E, B>::size_type
+hash_table<K, V, H, E, B>::erase_key(const Key& key) {
+  if (table_.empty()) {
+    return 0;
+  }
+
+  size_type hash = compute_hash(key);
+  size_type index = bucket_index(hash);
+  auto& bucket = table_[index];
+  auto it = find_in_bucket(bucket, key, hash);
+  if (it == bucket.end()) {
+    return 0;
+  }
+
+  bucket.erase(it);
   --size_;
+  note_erase(index);
+
+  return 1;
 }
 
 }  // namespace s21
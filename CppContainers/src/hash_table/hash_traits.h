@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+
+namespace s21 {
+
+namespace detail {
+
+template <typename T, typename = void>
+struct is_transparent : std::false_type {};
+
+template <typename T>
+struct is_transparent<T, std::void_t<typename T::is_transparent>>
+    : std::true_type {};
+
+// Enables the heterogeneous lookup overloads of the hash containers when
+// both Hash and KeyEqual declare is_transparent, so find("key") on a
+// std::string table hashes and compares the argument without building a
+// key_type
+template <typename Hash, typename KeyEqual, typename Key>
+using transparent_key_t =
+    std::enable_if_t<is_transparent<Hash>::value &&
+                         is_transparent<KeyEqual>::value,
+                     Key>;
+
+// KeyEqual of a table that names none: std::equal_to<> for a transparent
+// Hash, so the Hash alone turns heterogeneous lookup on, and
+// std::equal_to<Key> otherwise
+template <typename Hash, typename Key>
+using default_key_equal_t =
+    std::conditional_t<is_transparent<Hash>::value, std::equal_to<>,
+                       std::equal_to<Key>>;
+
+// Spreads identity-like hashes such as std::hash<int> over all 64 bits: a
+// Fibonacci multiply, with the high half folded back into the low bits
+inline uint64_t mix_hash(uint64_t h) noexcept {
+  h *= 0x9e3779b97f4a7c15ULL;
+  return h ^ (h >> 32);
+}
+
+}  // namespace detail
+
+// Bucket policies pick how hash_table turns a hash into a bucket index and
+// which bucket counts it may use. count() rounds a requested bucket count
+// to a supported one.
+//
+// ModuloBuckets takes hash % count for any count: one division per lookup,
+// but every bit of the hash matters as it is.
+struct ModuloBuckets {
+  static size_t count(size_t requested) noexcept { return requested; }
+  static size_t index(size_t hash, size_t count) noexcept {
+    return hash % count;
+  }
+};
+
+// PowerOfTwoBuckets rounds counts up to a power of two and replaces the
+// division with Fibonacci hashing: the top log2(count) bits of hash times
+// 2^64 / phi. Masking the low bits instead would send identity hashes of
+// keys that differ only in their high bits, such as multiples of 1024, to a
+// few buckets; the top bits of the product depend on every bit of the hash
+// and spread arithmetic progressions of keys almost evenly.
+struct PowerOfTwoBuckets {
+  static size_t count(size_t requested) noexcept {
+    size_t count = 1;
+    while (count < requested) {
+      count <<= 1;
+    }
+    return count;
+  }
+  static size_t index(size_t hash, size_t count) noexcept {
+    uint64_t product = uint64_t(hash) * 0x9e3779b97f4a7c15ULL;
+    // Two shifts, since shifting a uint64_t by 64 when count is 1 is undefined
+    return size_t(product >> (63 - __builtin_ctzll(count)) >> 1);
+  }
+};
+
+}  // namespace s21
@@ -1,19 +1,34 @@
 #pragma once
 
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
 #include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
 
 #include "s21_list_iterator.h"
 #include "s21_list_node.h"
+#include "s21_list_pool.h"
 
 namespace s21 {
 
-template <typename T>
+// Circular doubly linked list around an embedded sentinel. Nodes are raw
+// links carved from a pool owned by the list, so pushes don't allocate once
+// a slab has room and teardown frees whole slabs. merge() and splice()
+// relink nodes across lists; a node that ends up in another list goes back
+// to the pool it came from when that list frees it.
+template <typename T, typename Allocator = std::allocator<T>>
 class List {
   using node = ListNode<T>;
-  using node_ptr = std::shared_ptr<node>;
+  using node_base = ListNodeBase;
+  using pool = ListNodePool<node, Allocator>;
 
  public:
   using value_type = T;
+  using allocator_type = Allocator;
   using reference = T&;
   using const_reference = const T&;
   using size_type = size_t;
@@ -21,14 +36,19 @@ class List {
   using const_iterator = ConstListIterator<T>;
 
   List() = default;
-  explicit List(size_type n, const_reference value = value_type{});
-  List(std::initializer_list<value_type> const& items);
-  List(const List& other) = default;
-  List(List&& other) noexcept = default;
-  ~List() noexcept = default;
+  explicit List(const Allocator& alloc);
+  explicit List(size_type n, const_reference value = value_type{},
+                const Allocator& alloc = Allocator());
+  List(std::initializer_list<value_type> const& items,
+       const Allocator& alloc = Allocator());
+  List(const List& other);
+  List(List&& other) noexcept;
+  ~List() noexcept;
 
-  List<T>& operator=(const List& other) = default;
-  List<T>& operator=(List&& other) noexcept = default;
+  List& operator=(const List& other);
+  List& operator=(List&& other) noexcept;
+
+  allocator_type get_allocator() const { return pool_.get_allocator(); }
 
   iterator begin();
   iterator end();
@@ -37,8 +57,10 @@ class List {
   const_iterator cbegin() const;
   const_iterator cend() const;
 
-  const_reference front();
-  const_reference back();
+  reference front();
+  const_reference front() const;
+  reference back();
+  const_reference back() const;
 
   bool empty() const noexcept;
   size_type size() const noexcept;
@@ -48,6 +70,9 @@ class List {
   void clear() noexcept;
 
   iterator insert(const_iterator pos, const_reference value);
+  iterator insert(const_iterator pos, value_type&& value);
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args&&... args);
   template <typename... Args>
   iterator insert_many(const_iterator pos, Args&&... args);
   template <typename... Args>
@@ -57,366 +82,663 @@ class List {
 
   void erase(iterator pos);
   void push_back(const_reference value);
+  void push_back(value_type&& value);
+  template <typename... Args>
+  reference emplace_back(Args&&... args);
   void pop_back();
   void push_front(const_reference value);
+  void push_front(value_type&& value);
+  template <typename... Args>
+  reference emplace_front(Args&&... args);
   void pop_front();
-  void swap(List<T>& other);
-  void merge(List<T>& other);
-  void splice(const_iterator pos, List<T>& other);
-  void reverse();
+  void swap(List& other) noexcept;
+  void merge(List& other);
+  template <typename Compare>
+  void merge(List& other, Compare comp);
+  void splice(const_iterator pos, List& other);
+  void splice(const_iterator pos, List& other, const_iterator it);
+  void splice(const_iterator pos, List& other, const_iterator first,
+              const_iterator last);
+  // Makes this list allocate its nodes from the slabs other uses, so many
+  // short lists (hash buckets) share large slabs instead of each carving
+  // small ones
+  void share_pool(List& other);
+  void reverse() noexcept;
   void unique();
   void sort();
+  template <typename Compare>
+  void sort(Compare comp);
 
  private:
-  node_ptr head{};
-  node_ptr tail{};
+  static T& data(node_base* ptr) noexcept {
+    return static_cast<node*>(ptr)->get_data();
+  }
+
+  template <typename... Args>
+  node* create_node(Args&&... args);
+  void destroy_node(node_base* ptr) noexcept;
+  // Points the sentinel at [first, last], or at itself when size_ is 0
+  void attach(node_base* first, node_base* last) noexcept;
+  // Rebuilds prev links and the sentinel from a null-terminated next chain
+  void attach_chain(node_base* first) noexcept;
+  // Links [first, last] in front of pos; the caller has already taken the
+  // chain out of the list it came from
+  static void link_before(node_base* pos, node_base* first,
+                          node_base* last) noexcept;
+
+  template <typename Compare>
+  static void merge_chains(node_base*& into, node_base* from, Compare& comp);
+
+  node_base sentinel_;
   size_type size_{};
+  pool pool_;
 };
 
-template <typename T>
-List<T>::List(size_type n, const_reference value) {
+template <typename T, typename Allocator>
+List<T, Allocator>::List(const Allocator& alloc) : pool_(alloc) {}
+
+template <typename T, typename Allocator>
+List<T, Allocator>::List(size_type n, const_reference value,
+                         const Allocator& alloc)
+    : pool_(alloc) {
   while (n--) {
     push_back(value);
   }
 }
 
-template <typename T>
-typename List<T>::size_type List<T>::size() const noexcept {
+template <typename T, typename Allocator>
+List<T, Allocator>::List(std::initializer_list<value_type> const& items,
+                         const Allocator& alloc)
+    : pool_(alloc) {
+  for (auto& el : items) {
+    push_back(el);
+  }
+}
+
+template <typename T, typename Allocator>
+List<T, Allocator>::List(const List& other)
+    : pool_(std::allocator_traits<Allocator>::
+                select_on_container_copy_construction(other.get_allocator())) {
+  for (auto& el : other) {
+    push_back(el);
+  }
+}
+
+template <typename T, typename Allocator>
+List<T, Allocator>::List(List&& other) noexcept
+    : size_(other.size_), pool_(std::move(other.pool_)) {
+  attach(other.sentinel_.next(), other.sentinel_.prev());
+  other.size_ = 0;
+  other.attach(nullptr, nullptr);
+}
+
+template <typename T, typename Allocator>
+List<T, Allocator>::~List() noexcept {
+  clear();
+}
+
+template <typename T, typename Allocator>
+List<T, Allocator>& List<T, Allocator>::operator=(const List& other) {
+  if (this != &other) {
+    List tmp(other);
+    swap(tmp);
+  }
+
+  return *this;
+}
+
+template <typename T, typename Allocator>
+List<T, Allocator>& List<T, Allocator>::operator=(List&& other) noexcept {
+  swap(other);
+
+  return *this;
+}
+
+template <typename T, typename Allocator>
+typename List<T, Allocator>::size_type List<T, Allocator>::size()
+    const noexcept {
   return size_;
 }
 
-template <typename T>
-bool List<T>::empty() const noexcept {
+template <typename T, typename Allocator>
+bool List<T, Allocator>::empty() const noexcept {
   return !size();
 }
 
-template <typename T>
-typename List<T>::size_type List<T>::max_size() const noexcept {
+template <typename T, typename Allocator>
+typename List<T, Allocator>::size_type List<T, Allocator>::max_size()
+    const noexcept {
   return std::numeric_limits<size_type>::max();
 }
 
-template <typename T>
-void List<T>::clear() noexcept {
-  head = tail = nullptr;
-  size_ = 0;
-}
+template <typename T, typename Allocator>
+void List<T, Allocator>::clear() noexcept {
+  // Slabs that only ever held this list's nodes are freed whole. Once
+  // nodes have come from or gone to other lists, or other lists share the
+  // slabs, each node is freed on its own so it gets back to the pool that
+  // carved it, and the slabs are kept for the next pushes.
+  if (pool_.exclusive()) {
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+      for (node_base* ptr = sentinel_.next(); ptr != &sentinel_;) {
+        node_base* next = ptr->next();
+        static_cast<node*>(ptr)->~node();
+        ptr = next;
+      }
+    }
+    pool_.release();
+  } else {
+    for (node_base* ptr = sentinel_.next(); ptr != &sentinel_;) {
+      node_base* next = ptr->next();
+      destroy_node(ptr);
+      ptr = next;
+    }
+  }
 
-template <typename T>
-void List<T>::push_back(const_reference value) {
-  insert_many_back(value);
+  size_ = 0;
+  attach(nullptr, nullptr);
 }
 
-template <typename T>
+template <typename T, typename Allocator>
 template <typename... Args>
-void List<T>::insert_many_back(Args&&... args) {
-  node_ptr ptr{};
-
+typename List<T, Allocator>::node* List<T, Allocator>::create_node(
+    Args&&... args) {
+  node* ptr = pool_.allocate();
   try {
-    ptr = std::make_shared<node>(std::forward<Args>(args)...);
-  } catch (std::bad_alloc& e) {
-    throw std::runtime_error("Error: failed to allocate memory");
+    ::new (static_cast<void*>(ptr))
+        node(std::in_place, std::forward<Args>(args)...);
+  } catch (...) {
+    pool_.deallocate(ptr);
+    throw;
   }
 
-  if (!head) {
-    head = tail = ptr;
-  } else {
-    ptr->set_prev(tail);
-    tail->set_next(ptr);
-    tail = ptr;
-  }
+  return ptr;
+}
 
-  size_ += sizeof...(args);
+template <typename T, typename Allocator>
+void List<T, Allocator>::destroy_node(node_base* ptr) noexcept {
+  node* element = static_cast<node*>(ptr);
+  element->~node();
+  pool_.deallocate(element);
 }
 
-template <typename T>
-void List<T>::pop_back() {
-  if (empty()) {
-    throw std::runtime_error("Error: List is empty");
+template <typename T, typename Allocator>
+void List<T, Allocator>::attach(node_base* first, node_base* last) noexcept {
+  if (!size_) {
+    sentinel_.set_next(&sentinel_);
+    sentinel_.set_prev(&sentinel_);
+    return;
   }
 
-  auto prev = tail->prev();
-  prev->set_next(nullptr);
-  tail = prev;
+  sentinel_.set_next(first);
+  sentinel_.set_prev(last);
+  first->set_prev(&sentinel_);
+  last->set_next(&sentinel_);
+}
 
-  --size_;
+template <typename T, typename Allocator>
+void List<T, Allocator>::push_back(const_reference value) {
+  emplace(cend(), value);
 }
 
-template <typename T>
-void List<T>::pop_front() {
-  if (empty()) {
-    throw std::runtime_error("Error: List is empty");
-  }
+template <typename T, typename Allocator>
+void List<T, Allocator>::push_back(value_type&& value) {
+  emplace(cend(), std::move(value));
+}
 
-  head = head->next();
-  if (head) {
-    head->set_prev(nullptr);
-  } else {
-    tail = nullptr;
-  }
+template <typename T, typename Allocator>
+template <typename... Args>
+typename List<T, Allocator>::reference List<T, Allocator>::emplace_back(
+    Args&&... args) {
+  return *emplace(cend(), std::forward<Args>(args)...);
+}
 
-  --size_;
+template <typename T, typename Allocator>
+void List<T, Allocator>::push_front(const_reference value) {
+  emplace(cbegin(), value);
 }
 
-template <typename T>
-void List<T>::push_front(const_reference value) {
-  insert_many_front(value);
+template <typename T, typename Allocator>
+void List<T, Allocator>::push_front(value_type&& value) {
+  emplace(cbegin(), std::move(value));
 }
 
-template <typename T>
+template <typename T, typename Allocator>
 template <typename... Args>
-void List<T>::insert_many_front(Args&&... args) {
-  node_ptr ptr{};
+typename List<T, Allocator>::reference List<T, Allocator>::emplace_front(
+    Args&&... args) {
+  return *emplace(cbegin(), std::forward<Args>(args)...);
+}
 
-  try {
-    ptr = std::make_shared<node>(std::forward<Args>(args)...);
-  } catch (std::bad_alloc& e) {
-    throw std::runtime_error("Error: failed to allocate memory");
-  }
+template <typename T, typename Allocator>
+template <typename... Args>
+void List<T, Allocator>::insert_many_back(Args&&... args) {
+  (push_back(std::forward<Args>(args)), ...);
+}
 
-  ptr->set_next(head);
-  if (head) {
-    head->set_prev(ptr);
-  }
-  head = ptr;
+// Each argument goes to the front in turn, so the last one ends up first
+template <typename T, typename Allocator>
+template <typename... Args>
+void List<T, Allocator>::insert_many_front(Args&&... args) {
+  (push_front(std::forward<Args>(args)), ...);
+}
 
-  if (!tail) {
-    tail = ptr;
+template <typename T, typename Allocator>
+void List<T, Allocator>::pop_back() {
+  if (empty()) {
+    throw std::runtime_error("Error: List is empty");
   }
 
-  size_ += sizeof...(args);
+  node_base* last = sentinel_.prev();
+  last->unhook();
+  destroy_node(last);
+  --size_;
 }
 
-template <typename T>
-List<T>::List(std::initializer_list<value_type> const& items) {
-  for (auto& el : items) {
-    push_back(el);
+template <typename T, typename Allocator>
+void List<T, Allocator>::pop_front() {
+  if (empty()) {
+    throw std::runtime_error("Error: List is empty");
   }
+
+  node_base* first = sentinel_.next();
+  first->unhook();
+  destroy_node(first);
+  --size_;
+}
+
+template <typename T, typename Allocator>
+typename List<T, Allocator>::iterator List<T, Allocator>::begin() {
+  return iterator{sentinel_.next()};
+}
+
+template <typename T, typename Allocator>
+typename List<T, Allocator>::const_iterator List<T, Allocator>::begin() const {
+  return const_iterator{sentinel_.next()};
 }
 
-template <typename T>
-typename List<T>::iterator List<T>::begin() {
-  return iterator{head};
+template <typename T, typename Allocator>
+typename List<T, Allocator>::const_iterator List<T, Allocator>::end() const {
+  return const_iterator{const_cast<node_base*>(&sentinel_)};
 }
 
-template <typename T>
-typename List<T>::const_iterator List<T>::begin() const {
-  return const_iterator{head};
+template <typename T, typename Allocator>
+typename List<T, Allocator>::iterator List<T, Allocator>::end() {
+  return iterator{&sentinel_};
 }
 
-template <typename T>
-typename List<T>::const_iterator List<T>::end() const {
-  return const_iterator{tail, true};
+template <typename T, typename Allocator>
+typename List<T, Allocator>::const_iterator List<T, Allocator>::cbegin()
+    const {
+  return begin();
 }
 
-template <typename T>
-typename List<T>::iterator List<T>::end() {
-  return iterator{tail, true};
+template <typename T, typename Allocator>
+typename List<T, Allocator>::const_iterator List<T, Allocator>::cend() const {
+  return end();
 }
 
-template <typename T>
-typename List<T>::const_iterator List<T>::cbegin() const {
-  return const_iterator{head};
+template <typename T, typename Allocator>
+typename List<T, Allocator>::reference List<T, Allocator>::front() {
+  return data(sentinel_.next());
 }
 
-template <typename T>
-typename List<T>::const_iterator List<T>::cend() const {
-  return const_iterator{tail, true};
+template <typename T, typename Allocator>
+typename List<T, Allocator>::const_reference List<T, Allocator>::front()
+    const {
+  return data(sentinel_.next());
 }
 
-template <typename T>
-typename List<T>::const_reference List<T>::front() {
-  return head->get_data();
+template <typename T, typename Allocator>
+typename List<T, Allocator>::reference List<T, Allocator>::back() {
+  return data(sentinel_.prev());
 }
 
-template <typename T>
-typename List<T>::const_reference List<T>::back() {
-  return tail->get_data();
+template <typename T, typename Allocator>
+typename List<T, Allocator>::const_reference List<T, Allocator>::back()
+    const {
+  return data(sentinel_.prev());
 }
 
-template <typename T>
-void List<T>::assign(iterator first, iterator last) {
+template <typename T, typename Allocator>
+void List<T, Allocator>::assign(iterator first, iterator last) {
   clear();
   for (; first != last; ++first) {
     push_back(*first);
   }
 }
 
-template <typename T>
-typename List<T>::iterator List<T>::insert(const_iterator pos,
-                                           const_reference value) {
-  return insert_many(pos, value);
+template <typename T, typename Allocator>
+typename List<T, Allocator>::iterator List<T, Allocator>::insert(
+    const_iterator pos, const_reference value) {
+  return emplace(pos, value);
 }
 
-template <typename T>
-template <typename... Args>
-typename List<T>::iterator List<T>::insert_many(const_iterator pos,
-                                                Args&&... args) {
-  if (pos == cbegin()) {
-    insert_many_front(T(std::forward<Args>(args)...));
-    return begin();
-  }
-
-  if (pos == cend()) {
-    insert_many_back(std::forward<Args>(args)...);
-    return end();
-  }
-
-  node_ptr new_node{};
-  try {
-    new_node = std::make_shared<node>(T(std::forward<Args>(args)...));
-  } catch (std::bad_alloc& e) {
-    throw std::runtime_error("Error: Failed to allocate memory");
-  }
-
-  node_ptr current = pos.get_ptr();
-  node_ptr prev = current->prev();
-
-  prev->set_next(new_node);
-  new_node->set_prev(prev);
-  new_node->set_next(current);
-  current->set_prev(new_node);
+template <typename T, typename Allocator>
+typename List<T, Allocator>::iterator List<T, Allocator>::insert(
+    const_iterator pos, value_type&& value) {
+  return emplace(pos, std::move(value));
+}
 
+// Constructs the element directly inside its node
+template <typename T, typename Allocator>
+template <typename... Args>
+typename List<T, Allocator>::iterator List<T, Allocator>::emplace(
+    const_iterator pos, Args&&... args) {
+  node* ptr = create_node(std::forward<Args>(args)...);
+  ptr->hook(pos.get_node());
   ++size_;
 
-  return iterator(new_node);
+  return iterator(ptr);
 }
 
-template <typename T>
-void List<T>::erase(iterator pos) {
-  if (pos == begin()) {
-    pop_front();
-    return;
-  }
+// Inserts every argument before pos, keeping their order, and returns an
+// iterator to the first one (pos itself when there are none)
+template <typename T, typename Allocator>
+template <typename... Args>
+typename List<T, Allocator>::iterator List<T, Allocator>::insert_many(
+    const_iterator pos, Args&&... args) {
+  iterator first(pos.get_node());
+  bool inserted = false;
+  (
+      [&](iterator it) {
+        if (!inserted) {
+          first = it;
+          inserted = true;
+        }
+      }(insert(pos, std::forward<Args>(args))),
+      ...);
+
+  return first;
+}
+
+// erase(end()) removes the last element
+template <typename T, typename Allocator>
+void List<T, Allocator>::erase(iterator pos) {
   if (pos == end()) {
     pop_back();
     return;
   }
 
-  node_ptr current = pos.get_ptr();
-  node_ptr prev = current->prev();
-  node_ptr next = current->next();
-
-  prev->set_next(next);
-  next->set_prev(prev);
-
+  node_base* ptr = pos.get_node();
+  ptr->unhook();
+  destroy_node(ptr);
   --size_;
 }
 
-template <typename T>
-void List<T>::swap(List<T>& other) {
-  std::swap(head, other.head);
-  std::swap(tail, other.tail);
+template <typename T, typename Allocator>
+void List<T, Allocator>::swap(List& other) noexcept {
+  if (this == &other) {
+    return;
+  }
+
+  node_base* first = sentinel_.next();
+  node_base* last = sentinel_.prev();
   std::swap(size_, other.size_);
+  pool_.swap(other.pool_);
+  attach(other.sentinel_.next(), other.sentinel_.prev());
+  other.attach(first, last);
 }
 
-template <typename T>
-void List<T>::sort() {
-  if (empty()) {
-    return;
+template <typename T, typename Allocator>
+void List<T, Allocator>::attach_chain(node_base* first) noexcept {
+  node_base* prev = &sentinel_;
+  for (node_base* ptr = first; ptr; ptr = ptr->next()) {
+    ptr->set_prev(prev);
+    prev->set_next(ptr);
+    prev = ptr;
   }
-  bool swapped;
-  do {
-    swapped = false;
-    node_ptr ptr = head;
-
-    while (ptr->next()) {
-      auto a = ptr->get_data();
-      auto b = ptr->next()->get_data();
-      if (a > b) {
-        ptr->set_data(b);
-        ptr->next()->set_data(a);
-        swapped = true;
+  prev->set_next(&sentinel_);
+  sentinel_.set_prev(prev);
+}
+
+// Merges the sorted null-terminated chain `from` into `into`. Elements of
+// `into` come first on ties, which keeps sort() stable. If comp throws,
+// `into` is left holding every node of both chains.
+template <typename T, typename Allocator>
+template <typename Compare>
+void List<T, Allocator>::merge_chains(node_base*& into, node_base* from,
+                                      Compare& comp) {
+  node_base head;
+  node_base* tail = &head;
+  node_base* left = into;
+  try {
+    while (left && from) {
+      if (comp(data(from), data(left))) {
+        tail->set_next(from);
+        tail = from;
+        from = from->next();
+      } else {
+        tail->set_next(left);
+        tail = left;
+        left = left->next();
       }
-      ptr = ptr->next();
     }
-  } while (swapped);
+  } catch (...) {
+    tail->set_next(left);
+    while (tail->next()) {
+      tail = tail->next();
+    }
+    tail->set_next(from);
+    into = head.next();
+    throw;
+  }
+
+  tail->set_next(left ? left : from);
+  into = head.next();
 }
 
-template <typename T>
-void List<T>::merge(List<T>& other) {
-  if (this == &other) {
+template <typename T, typename Allocator>
+void List<T, Allocator>::sort() {
+  sort(std::less<T>());
+}
+
+// Bottom-up merge sort over the node links. bins[i] holds a sorted run of
+// 2^i nodes taken from earlier in the list than any lower bin, so merging a
+// bin into a newer run never reorders equal elements. Payloads are never
+// copied, moved or swapped.
+template <typename T, typename Allocator>
+template <typename Compare>
+void List<T, Allocator>::sort(Compare comp) {
+  if (size_ < 2) {
     return;
   }
-  if (empty()) {
-    assign(other.begin(), other.end());
-  } else {
-    for (auto& el : other) {
-      this->push_back(el);
+
+  constexpr size_t kBins = std::numeric_limits<size_type>::digits;
+  node_base* bins[kBins] = {};
+  size_t used = 0;
+
+  sentinel_.prev()->set_next(nullptr);
+  node_base* rest = sentinel_.next();
+  try {
+    while (rest) {
+      node_base* run = rest;
+      rest = rest->next();
+      run->set_next(nullptr);
+
+      size_t i = 0;
+      for (; i < used && bins[i]; ++i) {
+        merge_chains(bins[i], std::exchange(run, nullptr), comp);
+        run = std::exchange(bins[i], nullptr);
+      }
+      bins[i] = run;
+      used = std::max(used, i + 1);
+    }
+
+    // Each chain leaves its bin before it is merged, since a throwing comp
+    // leaves its nodes in the bin it was merged into
+    for (size_t i = 1; i < used; ++i) {
+      node_base* lower = std::exchange(bins[i - 1], nullptr);
+      if (!lower) {
+        continue;
+      }
+      if (bins[i]) {
+        merge_chains(bins[i], lower, comp);
+      } else {
+        bins[i] = lower;
+      }
+    }
+  } catch (...) {
+    // Every node is still in a bin or in the unsorted rest; put them all
+    // back so the list stays whole, if no longer in order
+    node_base* chain = rest;
+    for (size_t i = 0; i < used; ++i) {
+      for (node_base* ptr = bins[i]; ptr;) {
+        node_base* next = ptr->next();
+        ptr->set_next(chain);
+        chain = ptr;
+        ptr = next;
+      }
     }
+    attach_chain(chain);
+    throw;
   }
 
-  this->sort();
+  attach_chain(bins[used - 1]);
 }
 
-template <typename T>
-void List<T>::splice(const_iterator pos, List<T>& other) {
-  if (empty()) {
-    assign(other.begin(), other.end());
-  } else if (pos == cbegin()) {
-    auto tmp_head = head;
-    auto tmp_tail = tail;
-    size_type tmp_size = size();
+template <typename T, typename Allocator>
+void List<T, Allocator>::link_before(node_base* pos, node_base* first,
+                                     node_base* last) noexcept {
+  node_base* prev = pos->prev();
+  prev->set_next(first);
+  first->set_prev(prev);
+  last->set_next(pos);
+  pos->set_prev(last);
+}
 
-    assign(other.begin(), other.end());
+template <typename T, typename Allocator>
+void List<T, Allocator>::merge(List& other) {
+  merge(other, std::less<T>());
+}
 
-    tail->set_next(tmp_head);
-    tmp_head->set_prev(tail);
-    tail = tmp_tail;
+// One pass over both lists that moves each node of other in front of the
+// first element of this list that compares greater. Equal elements of this
+// list stay first. Nothing is allocated or copied, and other ends up empty.
+template <typename T, typename Allocator>
+template <typename Compare>
+void List<T, Allocator>::merge(List& other, Compare comp) {
+  if (this == &other || other.empty()) {
+    return;
+  }
+  pool_.adopt(other.pool_);
 
-    size_ += tmp_size;
-  } else {
-    auto it = pos;
-    for (auto& el : other) {
-      it = insert(it, el);
+  size_type moved = 0;
+  node_base* pos = sentinel_.next();
+  node_base* ptr = other.sentinel_.next();
+  try {
+    while (ptr != &other.sentinel_) {
+      if (pos == &sentinel_) {
+        link_before(pos, ptr, other.sentinel_.prev());
+        moved = other.size_;
+        break;
+      }
+      if (comp(data(ptr), data(pos))) {
+        node_base* next = ptr->next();
+        link_before(pos, ptr, ptr);
+        ptr = next;
+        ++moved;
+      } else {
+        pos = pos->next();
+      }
     }
+  } catch (...) {
+    // Whatever was not moved yet stays behind in other
+    size_ += moved;
+    other.size_ -= moved;
+    other.attach(ptr, other.sentinel_.prev());
+    throw;
   }
+
+  size_ += moved;
+  other.size_ = 0;
+  other.attach(nullptr, nullptr);
 }
 
-template <typename T>
-void List<T>::reverse() {
-  if (empty()) {
+template <typename T, typename Allocator>
+void List<T, Allocator>::share_pool(List& other) {
+  pool_.share(other.pool_);
+}
+
+// The splice overloads only relink nodes: no element is copied and the
+// allocator is never called. Moving a range out of another list counts it,
+// as std::list does; the other forms are constant time.
+template <typename T, typename Allocator>
+void List<T, Allocator>::splice(const_iterator pos, List& other) {
+  if (this == &other || other.empty()) {
     return;
   }
+  pool_.adopt(other.pool_);
 
-  node_ptr it = head;
-  node_ptr next = nullptr;
-  node_ptr prev = nullptr;
+  link_before(pos.get_node(), other.sentinel_.next(), other.sentinel_.prev());
+  size_ += other.size_;
+  other.size_ = 0;
+  other.attach(nullptr, nullptr);
+}
 
-  while (it) {
-    next = it->next();
-    it->set_prev(next);
-    it->set_next(prev);
+template <typename T, typename Allocator>
+void List<T, Allocator>::splice(const_iterator pos, List& other,
+                                const_iterator it) {
+  node_base* ptr = it.get_node();
+  if (ptr == pos.get_node() || ptr->next() == pos.get_node()) {
+    return;
+  }
+  if (this != &other) {
+    pool_.adopt(other.pool_);
+    ++size_;
+    --other.size_;
+  }
 
-    prev = it;
-    it = next;
+  ptr->unhook();
+  link_before(pos.get_node(), ptr, ptr);
+}
+
+template <typename T, typename Allocator>
+void List<T, Allocator>::splice(const_iterator pos, List& other,
+                                const_iterator first, const_iterator last) {
+  if (first == last) {
+    return;
+  }
+  if (this != &other) {
+    size_type count = std::distance(first, last);
+    pool_.adopt(other.pool_);
+    size_ += count;
+    other.size_ -= count;
   }
 
-  tail = head;
-  head = prev;
+  node_base* head = first.get_node();
+  node_base* tail = last.get_node()->prev();
+  head->prev()->set_next(last.get_node());
+  last.get_node()->set_prev(head->prev());
+  link_before(pos.get_node(), head, tail);
 }
 
-template <typename T>
-void List<T>::unique() {
+template <typename T, typename Allocator>
+void List<T, Allocator>::reverse() noexcept {
+  node_base* ptr = &sentinel_;
+  do {
+    node_base* next = ptr->next();
+    ptr->set_next(ptr->prev());
+    ptr->set_prev(next);
+    ptr = next;
+  } while (ptr != &sentinel_);
+}
+
+template <typename T, typename Allocator>
+void List<T, Allocator>::unique() {
   if (empty()) {
     return;
   }
 
-  node_ptr current = head;
-  while (current && current->next()) {
-    if (current->get_data() == current->next()->get_data()) {
-      node_ptr duplicate = current->next();
-      while (duplicate && duplicate->next() &&
-             duplicate->next()->get_data() == current->get_data()) {
-        duplicate = duplicate->next();
-      }
-      current->set_next(duplicate->next());
-      if (duplicate->next()) {
-        duplicate->next()->set_prev(current);
-      } else {
-        tail = current;
-      }
+  node_base* current = sentinel_.next();
+  while (current->next() != &sentinel_) {
+    node_base* next = current->next();
+    if (data(current) == data(next)) {
+      next->unhook();
+      destroy_node(next);
+      --size_;
+    } else {
+      current = next;
     }
-    current = current->next();
   }
 }
 
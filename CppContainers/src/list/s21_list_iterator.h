@@ -1,10 +1,14 @@
-#include <memory>
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
 
 #include "s21_list_node.h"
 
 namespace s21 {
 
-template <typename T>
+template <typename T, typename Allocator>
 class List;
 
 template <typename T>
@@ -19,81 +23,29 @@ class BaseListIterator {
 
   BaseListIterator() = default;
 
-  std::weak_ptr<node> get_wp() const { return ptr_; }
-  bool get_end() const { return is_end_; }
-
-  explicit operator bool() const noexcept {
-    return !ptr_.expired() && is_end_ && get_ptr().get() != nullptr;
-  }
-  bool is_alive() const noexcept { return (bool)*this; }
+  ListNodeBase* get_node() const noexcept { return ptr_; }
 
-  reference operator*() const { return get_ref().get_data(); }
-  pointer operator->() const { return &get_ptr()->get_data(); }
+  reference operator*() const { return static_cast<node*>(ptr_)->get_data(); }
+  pointer operator->() const { return &**this; }
 
  protected:
-  BaseListIterator(std::weak_ptr<node> ptr, bool is_end = false)
-      : ptr_(ptr), is_end_(is_end) {}
-
-  std::shared_ptr<node> get_shared() const {
-    try {
-      return ptr_.lock();
-    } catch (std::bad_weak_ptr& e) {
-      throw std::runtime_error(
-          "Error: Attempt to access an expired weak pointer");
-    }
-  }
-
-  std::shared_ptr<node> get_ptr() const { return get_shared(); }
-
-  node& get_ref() const { return *get_ptr(); }
-
-  void next() {
-    if (is_end_) {
-      throw std::out_of_range("Error: Attempt to access beyond list");
-    }
-
-    auto shared = get_shared();
-    auto next = shared->next();
-    if (next == nullptr) {
-      is_end_ = true;
-    }
-    ptr_ = next;
-  }
-
-  void prev() {
-    if (is_end_) {
-      is_end_ = false;
-      return;
-    }
-
-    auto shared = get_shared();
-    ptr_ = shared->prev();
-  }
-
-  bool equals(const BaseListIterator<T>& other) const {
-    if (ptr_.expired() && other.ptr_.expired()) {
-      return true;
-    }
+  explicit BaseListIterator(ListNodeBase* ptr) noexcept : ptr_(ptr) {}
 
-    if ((ptr_.expired() && is_end_) &&
-        (other.ptr_.expired() && other.is_end_)) {
-      return true;
-    }
-    if (is_end_ && other.is_end_) {
-      return true;
-    }
+  void next() noexcept { ptr_ = ptr_->next(); }
+  void prev() noexcept { ptr_ = ptr_->prev(); }
 
-    return !is_end_ && !other.is_end_ && get_ptr() == other.get_ptr();
+  bool equals(const BaseListIterator<T>& other) const noexcept {
+    return ptr_ == other.ptr_;
   }
 
-  std::weak_ptr<node> ptr_;
-  bool is_end_;
+  ListNodeBase* ptr_{};
 };
 
 template <typename T>
 class ListIterator : public BaseListIterator<T> {
  public:
-  friend class List<T>;
+  template <typename, typename>
+  friend class List;
   using base = BaseListIterator<T>;
   using value_type = typename base::value_type;
   using pointer = typename base::pointer;
@@ -156,7 +108,8 @@ ListIterator<T> ListIterator<T>::operator--(int) {
 template <typename T>
 class ConstListIterator : public BaseListIterator<const T> {
  public:
-  friend class List<T>;
+  template <typename, typename>
+  friend class List;
   using base = BaseListIterator<const T>;
   using value_type = typename base::value_type;
   using pointer = typename base::pointer;
@@ -167,10 +120,8 @@ class ConstListIterator : public BaseListIterator<const T> {
   ConstListIterator() = default;
   ConstListIterator(const ConstListIterator<T>& other) = default;
   ConstListIterator(ConstListIterator<T>&& other) noexcept = default;
-  ConstListIterator(const ListIterator<T>& other)
-      : base(other.get_wp(), other.get_end()) {}
-  ConstListIterator(ListIterator<T>&& other)
-      : base(other.get_wp(), other.get_end()) {}
+  ConstListIterator(const ListIterator<T>& other) noexcept
+      : base(other.get_node()) {}
   ~ConstListIterator() = default;
 
   ConstListIterator<T>& operator=(const ConstListIterator<T>& other) = default;
@@ -1,36 +1,56 @@
 #pragma once
 
-#include <memory>
+#include <utility>
 
 namespace s21 {
 
-template <typename T>
-class ListNode {
+// Links shared by element nodes and the list's sentinel. An unlinked node
+// points at itself, which is exactly the state of an empty list's sentinel.
+class ListNodeBase {
  public:
-  ListNode() = default;
-  explicit ListNode(const T& data) noexcept : data_(data) {}
-  explicit ListNode(T&& data) noexcept : data_(data) {}
-  template <typename... Args>
-  explicit ListNode(Args&&... args) {
-    ((data_ = std::forward<Args>(args)), ...);
+  ListNodeBase() noexcept : next_(this), prev_(this) {}
+  ListNodeBase(const ListNodeBase& other) = delete;
+  ListNodeBase& operator=(const ListNodeBase& other) = delete;
+  ~ListNodeBase() = default;
+
+  ListNodeBase* next() const noexcept { return next_; }
+  ListNodeBase* prev() const noexcept { return prev_; }
+  void set_next(ListNodeBase* next) noexcept { next_ = next; }
+  void set_prev(ListNodeBase* prev) noexcept { prev_ = prev; }
+
+  // Links this node in front of pos
+  void hook(ListNodeBase* pos) noexcept {
+    next_ = pos;
+    prev_ = pos->prev_;
+    prev_->next_ = this;
+    pos->prev_ = this;
+  }
+
+  void unhook() noexcept {
+    prev_->next_ = next_;
+    next_->prev_ = prev_;
   }
 
-  ListNode(const ListNode<T>& other) = default;
-  ListNode(ListNode<T>&& other) = default;
-  ~ListNode() noexcept = default;
+ private:
+  ListNodeBase* next_;
+  ListNodeBase* prev_;
+};
+
+template <typename T>
+class ListNode : public ListNodeBase {
+ public:
+  // Builds the payload in place from the arguments of an emplace call
+  template <typename... Args>
+  explicit ListNode(std::in_place_t, Args&&... args)
+      : data_(std::forward<Args>(args)...) {}
+  ~ListNode() = default;
 
-  std::shared_ptr<ListNode> next() noexcept { return next_; }
-  std::shared_ptr<ListNode> prev() noexcept { return prev_.lock(); }
   T& get_data() & noexcept { return data_; }
   const T& get_data() const& noexcept { return data_; }
-  void set_data(const T data) { data_ = data; }
-  void set_next(std::shared_ptr<ListNode> next) { next_ = next; }
-  void set_prev(std::shared_ptr<ListNode> prev) { prev_ = prev; }
+  void set_data(T data) { data_ = std::move(data); }
 
  private:
-  std::shared_ptr<ListNode> next_;
-  std::weak_ptr<ListNode> prev_;
-  T data_{};
+  T data_;
 };
 
 }  // namespace s21
@@ -0,0 +1,333 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace s21 {
+
+// Hands out node storage carved from slabs. Freed nodes go on an intrusive
+// free list for reuse, and release() returns every slab to the allocator at
+// once. Slabs start at one node and double up to kMaxSlabBytes, so short
+// lists stay small.
+//
+// Slabs, the free list and the slab being carved belong to an arena that
+// the pool points at. Many short lists, such as hash buckets, can share one
+// arena from the start with share() and draw from its large slabs; those
+// lists must be used from one thread, like a single container.
+//
+// Arenas are never merged. Each node slot is tagged with its slab, so when
+// splice() or merge() moves a node to a list with another arena, that list
+// frees the node back to its own arena: the slot goes on the arena's remote
+// free list, which is atomic, and the owner picks it up on a later
+// allocate(). Each slab counts its nodes that are still alive, so once its
+// arena is released the slab is freed by whoever frees its last node, on
+// any thread. Pools that exchange nodes must have equal allocators, as with
+// std::list.
+template <typename Node, typename Allocator>
+class ListNodePool {
+  using alloc_traits =
+      typename std::allocator_traits<Allocator>::template rebind_traits<Node>;
+  using node_allocator = typename alloc_traits::allocator_type;
+
+ public:
+  ListNodePool() = default;
+  explicit ListNodePool(const Allocator& alloc) : alloc_(alloc) {}
+  ListNodePool(const ListNodePool& other) = delete;
+  ListNodePool(ListNodePool&& other) noexcept;
+  ~ListNodePool() { release(); }
+
+  ListNodePool& operator=(const ListNodePool& other) = delete;
+  ListNodePool& operator=(ListNodePool&& other) = delete;
+
+  // Uninitialized storage for one node; the caller constructs the node
+  Node* allocate();
+  // Takes back a destroyed node from this pool or from any other
+  void deallocate(Node* ptr) noexcept;
+  // Gives up this pool's arena. Nodes the list still holds must have been
+  // destroyed and passed to deallocate() first, unless exclusive() is true,
+  // in which case destroying them is enough.
+  void release() noexcept;
+  // Whether another pool draws from this pool's arena through share()
+  bool shared() const noexcept;
+  // Whether the list owns every node of this pool's arena and nothing else,
+  // so release() may free the slabs without visiting the nodes
+  bool exclusive() const noexcept;
+  // Records that nodes of other are about to be linked into this pool's
+  // list; either pool may have no arena yet
+  void adopt(ListNodePool& other) noexcept;
+  // Lets this pool allocate from other's arena. A pool that already has an
+  // arena keeps it; one without joins other's, creating it if needed.
+  void share(ListNodePool& other);
+  void swap(ListNodePool& other) noexcept;
+
+  Allocator get_allocator() const { return Allocator(alloc_); }
+
+ private:
+  struct Arena;
+  // Slot 0 of each slab; the arena itself follows the header of its first
+  // (home) slab. `allocated` counts this slab's nodes handed out and not
+  // freed by a pool of the arena, and only those pools touch it. `pending`
+  // goes down once per node freed by another arena's pool, and release()
+  // adds `allocated` to it, after which it is the number of live nodes.
+  struct Slab {
+    Slab* next;
+    size_t units;
+    Arena* arena;
+    std::ptrdiff_t allocated;
+    std::atomic<std::ptrdiff_t> pending;
+  };
+  // Free-list link, stored in the node part of a released slot
+  struct FreeSlot {
+    FreeSlot* next;
+  };
+  // [next, end) is the uncarved rest of the newest slab. `refs` is one per
+  // slab still allocated plus one while any pool uses the arena; the home
+  // slab is freed last, when it drops to zero.
+  struct Arena {
+    Slab* slabs;
+    FreeSlot* free;
+    unsigned char* next;
+    unsigned char* end;
+    size_t next_capacity;
+    size_t users;
+    bool lent;
+    std::atomic<FreeSlot*> remote;
+    std::atomic<size_t> refs;
+  };
+  static_assert(sizeof(Node) >= sizeof(FreeSlot) &&
+                    alignof(Node) >= alignof(Slab) &&
+                    alignof(Node) >= alignof(Arena),
+                "List nodes must be able to hold the pool bookkeeping");
+
+  static constexpr size_t round_up(size_t bytes) noexcept {
+    return (bytes + alignof(Node) - 1) / alignof(Node) * alignof(Node);
+  }
+
+  // Every slot is the owning slab's address followed by the node
+  static constexpr size_t kTagBytes = round_up(sizeof(Slab*));
+  static constexpr size_t kSlotBytes = kTagBytes + sizeof(Node);
+  static constexpr size_t kSlabBytes = round_up(sizeof(Slab));
+  static constexpr size_t kArenaBytes = round_up(sizeof(Arena));
+  static constexpr size_t kMaxSlabBytes = 64 * 1024;
+  static constexpr size_t kMaxSlabNodes =
+      kMaxSlabBytes / kSlotBytes ? kMaxSlabBytes / kSlotBytes : 1;
+
+  static Slab*& tag(Node* ptr) noexcept {
+    return *reinterpret_cast<Slab**>(reinterpret_cast<unsigned char*>(ptr) -
+                                     kTagBytes);
+  }
+  static Slab* home(Arena* arena) noexcept {
+    return reinterpret_cast<Slab*>(reinterpret_cast<unsigned char*>(arena) -
+                                   kSlabBytes);
+  }
+
+  // Carves a new slab into this pool's arena, creating the arena first
+  // when the pool has none
+  void add_slab();
+  // Hands a node of another arena back to it
+  void free_remote(Slab* slab, Node* ptr) noexcept;
+  void free_slab(Slab* slab) noexcept;
+  void unref(Arena* arena) noexcept;
+
+  node_allocator alloc_{};
+  Arena* arena_{};
+  // Whether the list may hold nodes of another arena
+  bool borrowed_{};
+};
+
+template <typename Node, typename Allocator>
+ListNodePool<Node, Allocator>::ListNodePool(ListNodePool&& other) noexcept
+    : alloc_(other.alloc_) {
+  swap(other);
+}
+
+template <typename Node, typename Allocator>
+Node* ListNodePool<Node, Allocator>::allocate() {
+  if (!arena_) {
+    add_slab();
+  }
+
+  Arena* arena = arena_;
+  if (!arena->free && arena->remote.load(std::memory_order_relaxed)) {
+    arena->free = arena->remote.exchange(nullptr, std::memory_order_acquire);
+  }
+  Node* ptr{};
+  if (FreeSlot* slot = arena->free) {
+    arena->free = slot->next;
+    ptr = reinterpret_cast<Node*>(slot);
+  } else {
+    if (arena->next == arena->end) {
+      add_slab();
+    }
+    ptr = reinterpret_cast<Node*>(arena->next + kTagBytes);
+    tag(ptr) = arena->slabs;
+    arena->next += kSlotBytes;
+  }
+  ++tag(ptr)->allocated;
+
+  return ptr;
+}
+
+template <typename Node, typename Allocator>
+void ListNodePool<Node, Allocator>::deallocate(Node* ptr) noexcept {
+  Slab* slab = tag(ptr);
+  if (slab->arena != arena_) {
+    free_remote(slab, ptr);
+    return;
+  }
+
+  --slab->allocated;
+  arena_->free = ::new (static_cast<void*>(ptr)) FreeSlot{arena_->free};
+}
+
+// The slot is published before the slab count drops, since the slab and
+// its arena may be freed as soon as it does
+template <typename Node, typename Allocator>
+void ListNodePool<Node, Allocator>::free_remote(Slab* slab,
+                                                Node* ptr) noexcept {
+  Arena* arena = slab->arena;
+  FreeSlot* slot = ::new (static_cast<void*>(ptr))
+      FreeSlot{arena->remote.load(std::memory_order_relaxed)};
+  while (!arena->remote.compare_exchange_weak(slot->next, slot,
+                                              std::memory_order_release,
+                                              std::memory_order_relaxed)) {
+  }
+  if (slab->pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    free_slab(slab);
+  }
+}
+
+template <typename Node, typename Allocator>
+void ListNodePool<Node, Allocator>::free_slab(Slab* slab) noexcept {
+  Arena* arena = slab->arena;
+  if (slab != home(arena)) {
+    alloc_traits::deallocate(alloc_, reinterpret_cast<Node*>(slab),
+                             slab->units);
+  }
+  unref(arena);
+}
+
+template <typename Node, typename Allocator>
+void ListNodePool<Node, Allocator>::unref(Arena* arena) noexcept {
+  if (arena->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    Slab* slab = home(arena);
+    alloc_traits::deallocate(alloc_, reinterpret_cast<Node*>(slab),
+                             slab->units);
+  }
+}
+
+// An arena no node ever left is freed whole. Otherwise each slab without
+// live nodes is freed now and the rest by the pool that frees their last
+// node.
+template <typename Node, typename Allocator>
+void ListNodePool<Node, Allocator>::release() noexcept {
+  Arena* arena = std::exchange(arena_, nullptr);
+  borrowed_ = false;
+  if (!arena || --arena->users) {
+    return;
+  }
+
+  for (Slab* slab = arena->slabs; slab;) {
+    Slab* next = slab->next;
+    if (!arena->lent) {
+      if (slab != home(arena)) {
+        alloc_traits::deallocate(alloc_, reinterpret_cast<Node*>(slab),
+                                 slab->units);
+      }
+    } else {
+      std::ptrdiff_t allocated = slab->allocated;
+      if (slab->pending.fetch_add(allocated, std::memory_order_acq_rel) +
+              allocated ==
+          0) {
+        free_slab(slab);
+      }
+    }
+    slab = next;
+  }
+  if (!arena->lent) {
+    Slab* slab = home(arena);
+    alloc_traits::deallocate(alloc_, reinterpret_cast<Node*>(slab),
+                             slab->units);
+  } else {
+    unref(arena);
+  }
+}
+
+template <typename Node, typename Allocator>
+bool ListNodePool<Node, Allocator>::shared() const noexcept {
+  return arena_ && arena_->users > 1;
+}
+
+template <typename Node, typename Allocator>
+bool ListNodePool<Node, Allocator>::exclusive() const noexcept {
+  return !borrowed_ && (!arena_ || (arena_->users == 1 && !arena_->lent));
+}
+
+template <typename Node, typename Allocator>
+void ListNodePool<Node, Allocator>::adopt(ListNodePool& other) noexcept {
+  if (this == &other) {
+    return;
+  }
+  if (other.arena_ && other.arena_ != arena_) {
+    other.arena_->lent = true;
+    borrowed_ = true;
+  }
+  borrowed_ = borrowed_ || other.borrowed_;
+}
+
+template <typename Node, typename Allocator>
+void ListNodePool<Node, Allocator>::share(ListNodePool& other) {
+  if (this == &other || arena_) {
+    return;
+  }
+  if (!other.arena_) {
+    other.add_slab();
+  }
+
+  arena_ = other.arena_;
+  ++arena_->users;
+}
+
+template <typename Node, typename Allocator>
+void ListNodePool<Node, Allocator>::swap(ListNodePool& other) noexcept {
+  std::swap(alloc_, other.alloc_);
+  std::swap(arena_, other.arena_);
+  std::swap(borrowed_, other.borrowed_);
+}
+
+template <typename Node, typename Allocator>
+void ListNodePool<Node, Allocator>::add_slab() {
+  Arena* arena = arena_;
+  size_t capacity = arena ? arena->next_capacity : 1;
+  size_t header = arena ? kSlabBytes : kSlabBytes + kArenaBytes;
+  size_t units =
+      (header + capacity * kSlotBytes + sizeof(Node) - 1) / sizeof(Node);
+  Node* raw{};
+  try {
+    raw = alloc_traits::allocate(alloc_, units);
+  } catch (std::bad_alloc& e) {
+    throw std::runtime_error("Error: failed to allocate memory");
+  }
+
+  unsigned char* bytes = reinterpret_cast<unsigned char*>(raw);
+  if (!arena) {
+    arena = ::new (static_cast<void*>(bytes + kSlabBytes))
+        Arena{nullptr, nullptr, nullptr, nullptr, 1, 1, false, {nullptr}, {1}};
+    arena_ = arena;
+  }
+  // The old slab's uncarved rest is empty, so it can be left behind
+  Slab* slab = ::new (static_cast<void*>(bytes))
+      Slab{arena->slabs, units, arena, 0, {0}};
+  arena->slabs = slab;
+  arena->refs.fetch_add(1, std::memory_order_relaxed);
+  arena->next = bytes + header;
+  arena->end = arena->next + capacity * kSlotBytes;
+  arena->next_capacity = std::min(capacity * 2, kMaxSlabNodes);
+}
+
+}  // namespace s21
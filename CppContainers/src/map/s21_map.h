@@ -1,13 +1,21 @@
 #pragma once
 
+#include "flat_hash_table.h"
 #include "hash_table.h"
 
 namespace s21 {
 
-template <typename K, typename V, typename H = std::hash<K>>
+// Table is the storage backend: the chained hash_table by default, or
+// flat_hash_table<K, V, H> for open addressing. Keys are compared with
+// Table's key_equal, so a custom one goes into Table, as in
+// Map<K, V, H, hash_table<K, V, H, KeyEqual>>.
+template <typename K, typename V, typename H = std::hash<K>,
+          typename Table = hash_table<K, V, H>>
 class Map {
  public:
-  using table = s21::hash_table<K, V, H>;
+  using table = Table;
+  using hasher = typename table::hasher;
+  using key_equal = typename table::key_equal;
   using key_type = K;
   using mapped_type = V;
   using value_type = std::pair<key_type, mapped_type>;
@@ -34,13 +42,33 @@ class Map {
   bool empty() const noexcept { return t.empty(); }
   void clear() { return t.clear(); }
 
+  size_type bucket_count() const noexcept { return t.bucket_count(); }
+  float load_factor() const noexcept { return t.load_factor(); }
+  float max_load_factor() const noexcept { return t.max_load_factor(); }
+  void max_load_factor(float ml) { t.max_load_factor(ml); }
+  void rehash(size_type count) { t.rehash(count); }
+  void reserve(size_type count) { t.reserve(count); }
+
   iterator begin() { return t.begin(); }
   iterator end() { return t.end(); }
 
+  // at, erase(key), find and contains accept any Key comparable with
+  // key_type when hasher and key_equal declare is_transparent
   mapped_type& at(const key_type& key) { return t.at(key); }
+  template <typename Key,
+            typename = detail::transparent_key_t<hasher, key_equal, Key>>
+  mapped_type& at(const Key& key) {
+    return t.at(key);
+  }
   mapped_type& operator[](const key_type& key) { return t[key]; }
 
   void erase(iterator pos) { t.erase(pos); }
+  size_type erase(const key_type& key) { return t.erase(key); }
+  template <typename Key,
+            typename = detail::transparent_key_t<hasher, key_equal, Key>>
+  size_type erase(const Key& key) {
+    return t.erase(key);
+  }
   void swap(Map& other) { t.swap(other.t); }
 
   std::pair<iterator, bool> insert(const value_type& value) {
@@ -59,7 +87,18 @@ class Map {
     return t.insert_many(std::forward<Args>(args)...);
   }
 
+  iterator find(const key_type& key) { return t.find(key); }
+  template <typename Key,
+            typename = detail::transparent_key_t<hasher, key_equal, Key>>
+  iterator find(const Key& key) {
+    return t.find(key);
+  }
   bool contains(const key_type& key) const noexcept { return t.contains(key); }
+  template <typename Key,
+            typename = detail::transparent_key_t<hasher, key_equal, Key>>
+  bool contains(const Key& key) const noexcept {
+    return t.contains(key);
+  }
 
  private:
   table t;
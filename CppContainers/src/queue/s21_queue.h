@@ -38,9 +38,15 @@ class queue {
   size_type size() const noexcept { return c.size(); }
 
   void push(const_reference value) { c.push_back(value); }
+  void push(value_type&& value) { c.push_back(std::move(value)); }
 
   template <typename... Args>
-  void insert_many(Args... args) {
+  void emplace(Args&&... args) {
+    c.emplace_back(std::forward<Args>(args)...);
+  }
+
+  template <typename... Args>
+  void insert_many(Args&&... args) {
     c.insert_many_back(std::forward<Args>(args)...);
   }
 
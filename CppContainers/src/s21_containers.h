@@ -1,9 +1,14 @@
 #pragma once
 
 #include "s21_list.h"
+#include "s21_unrolled_list.h"
 #include "s21_vector.h"
+#include "s21_small_vector.h"
 #include "s21_stack.h"
 #include "s21_queue.h"
+#include "s21_mpmc_queue.h"
 #include "s21_map.h"
 #include "s21_set.h"
+#include "s21_concurrent_map.h"
 #include "s21_array.h"
+#include "s21_algo.h"
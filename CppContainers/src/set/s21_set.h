@@ -1,11 +1,19 @@
+#include "flat_hash_table.h"
 #include "hash_table.h"
 
 namespace s21 {
 
-template <typename K, typename H = std::hash<K>>
+// Table is the storage backend: the chained hash_table by default, or
+// flat_hash_table<K, K, H> for open addressing. Keys are compared with
+// Table's key_equal, so a custom one goes into Table, as in
+// Set<K, H, hash_table<K, K, H, KeyEqual>>.
+template <typename K, typename H = std::hash<K>,
+          typename Table = hash_table<K, K, H>>
 class Set {
  public:
-  using table = hash_table<K, K, H>;
+  using table = Table;
+  using hasher = typename table::hasher;
+  using key_equal = typename table::key_equal;
   using key_type = K;
   using mapped_type = K;
   using value_type = std::pair<key_type, mapped_type>;
@@ -34,18 +42,44 @@ class Set {
   bool empty() const noexcept { return t.empty(); }
   size_type size() const noexcept { return t.size(); }
 
+  size_type bucket_count() const noexcept { return t.bucket_count(); }
+  float load_factor() const noexcept { return t.load_factor(); }
+  float max_load_factor() const noexcept { return t.max_load_factor(); }
+  void max_load_factor(float ml) { t.max_load_factor(ml); }
+  void rehash(size_type count) { t.rehash(count); }
+  void reserve(size_type count) { t.reserve(count); }
+
   void clear() { t.clear(); }
   std::pair<iterator, bool> insert(const mapped_type& value) {
     value_type p = {value, value};
     return t.insert(p);
   }
   void erase(iterator pos) { t.erase(pos); }
+  // erase(key), find and contains accept any Key comparable with key_type
+  // when hasher and key_equal declare is_transparent
+  size_type erase(const key_type& key) { return t.erase(key); }
+  template <typename Key,
+            typename = detail::transparent_key_t<hasher, key_equal, Key>>
+  size_type erase(const Key& key) {
+    return t.erase(key);
+  }
   void swap(Set& other) { t.swap(other.t); }
 
   iterator find(const key_type& key) { return t.find(key); }
+  template <typename Key,
+            typename = detail::transparent_key_t<hasher, key_equal, Key>>
+  iterator find(const Key& key) {
+    return t.find(key);
+  }
   bool contains(const key_type& key) const noexcept { return t.contains(key); }
+  template <typename Key,
+            typename = detail::transparent_key_t<hasher, key_equal, Key>>
+  bool contains(const Key& key) const noexcept {
+    return t.contains(key);
+  }
   template <typename... Args>
   s21::Vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
+    t.reserve(t.size() + sizeof...(args));
     return {insert(std::forward<Args>(args))...};
   }
 
@@ -1,10 +1,20 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cctype>
+#include <iterator>
+#include <deque>
 #include <list>
 #include <map>
 #include <queue>
+#include <random>
 #include <set>
+#include <sstream>
 #include <stack>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 #include <array>
 
@@ -87,6 +97,38 @@ TEST(ArrayTest, Fill) {
   EXPECT_EQ(42, arr[4]);
 }
 
+TEST(ArrayTest, ConstAccessOperator) {
+  const s21::Array<int, 3> arr = {1, 2, 3};
+  EXPECT_EQ(1, arr[0]);
+  EXPECT_EQ(3, arr[2]);
+  EXPECT_EQ(2, arr.at(1));
+  EXPECT_ANY_THROW(arr.at(3));
+}
+
+#if S21_HARDENED
+TEST(ArrayTest, AccessOperatorHardened) {
+  s21::Array<int, 3> arr = {1, 2, 3};
+  EXPECT_THROW(arr[3], std::out_of_range);
+}
+#endif
+
+TEST(ArrayTest, FillTrivial) {
+  s21::Array<int, 64> ints;
+  ints.fill(-1);
+  EXPECT_EQ(-1, ints[0]);
+  EXPECT_EQ(-1, ints[63]);
+  ints.fill(0x01020304);
+  EXPECT_EQ(0x01020304, ints[17]);
+
+  s21::Array<double, 8> doubles;
+  doubles.fill(2.5);
+  EXPECT_EQ(2.5, doubles[7]);
+
+  s21::Array<std::string, 3> strings;
+  strings.fill("s21");
+  EXPECT_EQ("s21", strings[2]);
+}
+
 TEST(ArrayTest, Swap) {
   s21::Array<int, 3> arr1 = {1, 2, 3};
   s21::Array<int, 3> arr2 = {4, 5, 6};
@@ -345,6 +387,7 @@ TEST(VectorTest, Element_operator_square_brackets) {
   EXPECT_EQ(s21_v[2], std_v[2]);
 }
 
+#if S21_HARDENED
 TEST(VectorTest, Element_operator_square_brackets_throw_1) {
   s21::Vector<int> s21_v{1, 2, 3};
   EXPECT_ANY_THROW(s21_v[5]);
@@ -354,6 +397,7 @@ TEST(VectorTest, Element_operator_square_brackets_throw_2) {
   s21::Vector<int> s21_v{1, 2, 3};
   EXPECT_ANY_THROW(s21_v[-1]);
 }
+#endif
 
 TEST(VectorTest, Capacity_empty_1) {
   s21::Vector<int> s21_v{1, 2, 3};
@@ -485,6 +529,8 @@ TEST(VectorTest, Modifiers_insert_2) {
   EXPECT_EQ(s21_v.at(5), std_v.at(5));
 }
 
+#if S21_CHECKED_ITERATORS
+// Iterator bounds are only validated by the checked iterators
 TEST(VectorTest, Modifiers_insert_3) {
   try {
     s21::Vector<int> s21_v{50, 10, 40, 20, 30};
@@ -504,6 +550,7 @@ TEST(VectorTest, Modifiers_insert_4) {
     EXPECT_EQ(err.what(), std::string("Error: Step goes beyond vector size"));
   }
 }
+#endif
 
 TEST(VectorTest, Modifiers_erase_1) {
   s21::Vector<int> s21_v{1, 2, 3, 4};
@@ -541,6 +588,7 @@ TEST(VectorTest, Modifiers_erase_3) {
   EXPECT_EQ(s21_v.at(3), std_v.at(3));
 }
 
+#if S21_CHECKED_ITERATORS
 TEST(VectorTest, Modifiers_erase_4) {
   try {
     s21::Vector<int> s21_v{50, 10, 40, 20, 30};
@@ -560,6 +608,18 @@ TEST(VectorTest, Modifiers_erase_5) {
     EXPECT_EQ(err.what(), std::string("Error: Step goes beyond vector size"));
   }
 }
+#endif
+
+#if S21_HARDENED
+TEST(VectorTest, Modifiers_erase_outside_the_vector_throws) {
+  s21::Vector<int> s21_v{50, 10, 40, 20, 30};
+  EXPECT_THROW(s21_v.erase(s21_v.end()), std::out_of_range);
+  EXPECT_THROW(s21_v.erase(s21_v.begin() + 3, s21_v.begin() + 1),
+               std::out_of_range);
+  EXPECT_EQ(s21_v.size(), 5U);
+  EXPECT_EQ(s21_v.back(), 30);
+}
+#endif
 
 TEST(VectorTest, Modifiers_push_back_1) {
   s21::Vector<int> s21_v;
@@ -720,6 +780,676 @@ TEST(VectorTest, Helpers_add_memotysize_3) {
   EXPECT_EQ(s21_v.size(), n + 3);
 }
 
+struct CountedValue {
+  static inline int constructed = 0;
+  static inline int destroyed = 0;
+
+  CountedValue() { ++constructed; }
+  CountedValue(const CountedValue&) { ++constructed; }
+  CountedValue(CountedValue&&) noexcept { ++constructed; }
+  CountedValue& operator=(const CountedValue&) = default;
+  CountedValue& operator=(CountedValue&&) noexcept = default;
+  ~CountedValue() { ++destroyed; }
+
+  static void reset() { constructed = destroyed = 0; }
+};
+
+template <typename T>
+struct CountingAllocator {
+  using value_type = T;
+  static inline int allocations = 0;
+  // Allocations not yet deallocated
+  static inline int live = 0;
+
+  CountingAllocator() = default;
+  template <typename U>
+  CountingAllocator(const CountingAllocator<U>&) noexcept {}
+
+  T* allocate(size_t n) {
+    ++allocations;
+    ++live;
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T* p, size_t n) noexcept {
+    --live;
+    std::allocator<T>().deallocate(p, n);
+  }
+
+  bool operator==(const CountingAllocator&) const noexcept { return true; }
+  bool operator!=(const CountingAllocator&) const noexcept { return false; }
+};
+
+TEST(VectorTest, Reserve_does_not_construct) {
+  CountedValue::reset();
+  {
+    s21::Vector<CountedValue> s21_v;
+    s21_v.reserve(1000);
+    EXPECT_EQ(s21_v.capacity(), 1000);
+    EXPECT_EQ(CountedValue::constructed, 0);
+
+    s21_v.push_back(CountedValue{});
+    EXPECT_EQ(s21_v.size(), 1);
+  }
+  EXPECT_EQ(CountedValue::constructed, CountedValue::destroyed);
+}
+
+TEST(VectorTest, Destroys_every_element) {
+  CountedValue::reset();
+  {
+    s21::Vector<CountedValue> s21_v(10);
+    s21_v.pop_back();
+    s21_v.erase(s21_v.begin());
+    s21_v.insert(s21_v.begin() + 2, CountedValue{});
+    s21_v.shrink_to_fit();
+    s21_v.clear();
+    s21_v.push_back(CountedValue{});
+  }
+  EXPECT_EQ(CountedValue::constructed, CountedValue::destroyed);
+}
+
+TEST(VectorTest, Reserve_moves_elements) {
+  struct Tracked {
+    int copies = 0;
+    Tracked() = default;
+    Tracked(const Tracked& other) : copies(other.copies + 1) {}
+    Tracked(Tracked&& other) noexcept : copies(other.copies) {}
+    Tracked& operator=(const Tracked&) = default;
+  };
+
+  s21::Vector<Tracked> s21_v(4);
+  int copies = s21_v.at(0).copies;
+  s21_v.reserve(64);
+  s21_v.reserve(128);
+
+  for (auto& el : s21_v) {
+    EXPECT_EQ(el.copies, copies);
+  }
+}
+
+TEST(VectorTest, Reserve_move_only) {
+  s21::Vector<std::unique_ptr<int>> s21_v;
+  for (int i = 0; i < 100; ++i) {
+    s21_v.insert_many_back(std::make_unique<int>(i));
+  }
+
+  EXPECT_EQ(s21_v.size(), 100);
+  EXPECT_EQ(*s21_v.at(0), 0);
+  EXPECT_EQ(*s21_v.at(99), 99);
+}
+
+TEST(VectorTest, Modifiers_emplace_back) {
+  s21::Vector<std::pair<int, std::string>> s21_v;
+  auto& ref = s21_v.emplace_back(1, "one");
+  EXPECT_EQ(ref.second, "one");
+  s21_v.emplace_back(2, "two");
+
+  EXPECT_EQ(s21_v.size(), 2);
+  EXPECT_EQ(s21_v.at(1).first, 2);
+  EXPECT_EQ(s21_v.at(1).second, "two");
+}
+
+TEST(VectorTest, Modifiers_emplace) {
+  s21::Vector<std::string> s21_v{"a", "c"};
+  std::vector<std::string> std_v{"a", "c"};
+
+  auto it = s21_v.emplace(s21_v.begin() + 1, 1, 'b');
+  std_v.emplace(std_v.begin() + 1, 1, 'b');
+  s21_v.emplace(s21_v.end(), 2, 'd');
+  std_v.emplace(std_v.end(), 2, 'd');
+
+  EXPECT_EQ(*it, "b");
+  ASSERT_EQ(s21_v.size(), std_v.size());
+  for (size_t i = 0; i < std_v.size(); ++i) {
+    EXPECT_EQ(s21_v.at(i), std_v.at(i));
+  }
+}
+
+TEST(VectorTest, Modifiers_push_back_rvalue) {
+  s21::Vector<std::string> s21_v;
+  std::string value(100, 'x');
+  s21_v.push_back(std::move(value));
+
+  EXPECT_TRUE(value.empty());
+  EXPECT_EQ(s21_v.at(0).size(), 100);
+}
+
+TEST(VectorTest, Modifiers_push_back_self_reference) {
+  s21::Vector<std::string> s21_v{"first"};
+  for (int i = 0; i < 10; ++i) {
+    s21_v.push_back(s21_v.at(0));
+  }
+
+  for (auto& el : s21_v) {
+    EXPECT_EQ(el, "first");
+  }
+}
+
+TEST(VectorTest, Growth_logarithmic_allocations) {
+  using allocator = CountingAllocator<int>;
+  allocator::allocations = 0;
+  s21::Vector<int, allocator> s21_v;
+  for (int i = 0; i < 100000; ++i) {
+    s21_v.push_back(i);
+  }
+  EXPECT_LE(allocator::allocations, 18);
+
+  allocator::allocations = 0;
+  s21::Vector<int, allocator, s21::OneAndHalfGrowth> s21_one_and_half;
+  for (int i = 0; i < 100000; ++i) {
+    s21_one_and_half.insert_many_back(i, i, i);
+  }
+  EXPECT_EQ(s21_one_and_half.size(), 300000);
+  EXPECT_LE(allocator::allocations, 32);
+}
+
+TEST(VectorTest, Growth_insert_many_back_whole_pack) {
+  s21::Vector<int> s21_v{1};
+  s21_v.insert_many_back(2, 3, 4, 5, 6, 7);
+
+  EXPECT_EQ(s21_v.size(), 7);
+  EXPECT_GE(s21_v.capacity(), 7);
+  EXPECT_EQ(s21_v.at(6), 7);
+}
+
+TEST(VectorTest, Iterator_contiguous) {
+  s21::Vector<int> s21_v{1, 2, 3, 4, 5};
+  auto it = s21_v.begin();
+  for (size_t i = 0; i < s21_v.size(); ++i, ++it) {
+    EXPECT_EQ(&*it, s21_v.data() + i);
+  }
+  EXPECT_EQ(it, s21_v.end());
+
+#if !S21_CHECKED_ITERATORS
+  static_assert(std::is_same_v<s21::Vector<int>::iterator, int*>);
+  static_assert(std::is_same_v<s21::Vector<int>::const_iterator, const int*>);
+#endif
+}
+
+TEST(VectorTest, Modifiers_erase_range) {
+  s21::Vector<int> s21_v{1, 2, 3, 4, 5, 6, 7};
+  std::vector<int> std_v{1, 2, 3, 4, 5, 6, 7};
+
+  auto s21_it = s21_v.erase(s21_v.begin() + 1, s21_v.begin() + 4);
+  auto std_it = std_v.erase(std_v.begin() + 1, std_v.begin() + 4);
+
+  EXPECT_EQ(*s21_it, *std_it);
+  ASSERT_EQ(s21_v.size(), std_v.size());
+  for (size_t i = 0; i < std_v.size(); ++i) {
+    EXPECT_EQ(s21_v[i], std_v[i]);
+  }
+  s21_it = s21_v.erase(s21_v.begin() + 2, s21_v.end());
+  EXPECT_EQ(s21_it, s21_v.end());
+  EXPECT_EQ(s21_v.size(), 2);
+}
+
+TEST(VectorTest, Modifiers_erase_range_strings) {
+  s21::Vector<std::string> s21_v{"a", "b", "c", "d", "e"};
+  std::vector<std::string> std_v{"a", "b", "c", "d", "e"};
+
+  s21_v.erase(s21_v.begin(), s21_v.begin() + 2);
+  std_v.erase(std_v.begin(), std_v.begin() + 2);
+  auto it = s21_v.erase(s21_v.begin() + 1);
+  std_v.erase(std_v.begin() + 1);
+
+  EXPECT_EQ(*it, "e");
+  ASSERT_EQ(s21_v.size(), std_v.size());
+  for (size_t i = 0; i < std_v.size(); ++i) {
+    EXPECT_EQ(s21_v[i], std_v[i]);
+  }
+}
+
+TEST(VectorTest, Modifiers_insert_range) {
+  std::vector<std::string> source{"x", "y", "z"};
+  s21::Vector<std::string> s21_v{"a", "b", "c", "d"};
+  std::vector<std::string> std_v{"a", "b", "c", "d"};
+  s21_v.reserve(32);
+
+  auto it = s21_v.insert(s21_v.begin() + 1, source.begin(), source.end());
+  std_v.insert(std_v.begin() + 1, source.begin(), source.end());
+  EXPECT_EQ(*it, "x");
+
+  s21_v.insert(s21_v.begin() + 6, source.begin(), source.end());
+  std_v.insert(std_v.begin() + 6, source.begin(), source.end());
+  s21_v.insert(s21_v.end(), source.begin(), source.begin() + 1);
+  std_v.insert(std_v.end(), source.begin(), source.begin() + 1);
+
+  ASSERT_EQ(s21_v.size(), std_v.size());
+  for (size_t i = 0; i < std_v.size(); ++i) {
+    EXPECT_EQ(s21_v[i], std_v[i]);
+  }
+}
+
+TEST(VectorTest, Modifiers_insert_range_reallocates) {
+  s21::Vector<int> s21_v{1, 2};
+  std::list<int> source{7, 8, 9, 10};
+
+  auto it = s21_v.insert(s21_v.begin() + 1, source.begin(), source.end());
+
+  EXPECT_EQ(*it, 7);
+  EXPECT_EQ(s21_v.size(), 6);
+  EXPECT_EQ(s21_v[4], 10);
+  EXPECT_EQ(s21_v[5], 2);
+}
+
+TEST(VectorTest, Modifiers_insert_input_range) {
+  std::istringstream input("4 5 6");
+  s21::Vector<int> s21_v{1, 2, 3};
+
+  s21_v.insert(s21_v.begin() + 1, std::istream_iterator<int>(input),
+               std::istream_iterator<int>());
+
+  ASSERT_EQ(s21_v.size(), 6);
+  EXPECT_EQ(s21_v[1], 4);
+  EXPECT_EQ(s21_v[3], 6);
+  EXPECT_EQ(s21_v[5], 3);
+}
+
+TEST(VectorTest, Modifiers_insert_own_element) {
+  s21::Vector<int> s21_v{1, 2, 3};
+  std::vector<int> std_v{1, 2, 3};
+  s21_v.reserve(16);
+  std_v.reserve(16);
+
+  s21_v.insert(s21_v.begin(), s21_v[2]);
+  std_v.insert(std_v.begin(), std_v[2]);
+  s21_v.insert(s21_v.begin() + 2, s21_v[3]);
+  std_v.insert(std_v.begin() + 2, std_v[3]);
+
+  s21::Vector<std::string> s21_s{"a", "b", "c"};
+  std::vector<std::string> std_s{"a", "b", "c"};
+  s21_s.reserve(16);
+  std_s.reserve(16);
+  s21_s.insert(s21_s.begin(), s21_s[2]);
+  std_s.insert(std_s.begin(), std_s[2]);
+
+  ASSERT_EQ(s21_v.size(), std_v.size());
+  for (size_t i = 0; i < std_v.size(); ++i) {
+    EXPECT_EQ(s21_v[i], std_v[i]);
+  }
+  ASSERT_EQ(s21_s.size(), std_s.size());
+  for (size_t i = 0; i < std_s.size(); ++i) {
+    EXPECT_EQ(s21_s[i], std_s[i]);
+  }
+}
+
+TEST(VectorTest, Modifiers_insert_many_own_elements) {
+  s21::Vector<std::string> s21_v{"a", "b", "c"};
+  s21_v.reserve(16);
+
+  s21_v.insert_many(s21_v.begin(), s21_v[2], s21_v[0], s21_v[1]);
+
+  std::vector<std::string> expected{"c", "a", "b", "a", "b", "c"};
+  ASSERT_EQ(s21_v.size(), expected.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_EQ(s21_v[i], expected[i]);
+  }
+}
+
+TEST(VectorTest, Modifiers_insert_own_range) {
+  s21::Vector<std::string> s21_v{"a", "b", "c", "d"};
+  std::vector<std::string> std_v{"a", "b", "c", "d"};
+  s21_v.reserve(32);
+
+  s21_v.insert(s21_v.begin(), s21_v.begin() + 1, s21_v.end());
+  std_v.insert(std_v.begin(), std_v.begin() + 1, std_v.end());
+  std::vector<std::string> copy(std_v.rbegin(), std_v.rbegin() + 2);
+  auto reversed = std::make_reverse_iterator(s21_v.end());
+  s21_v.insert(s21_v.begin() + 2, reversed, std::next(reversed, 2));
+  std_v.insert(std_v.begin() + 2, copy.begin(), copy.end());
+
+  s21::Vector<int> s21_i{1, 2, 3, 4};
+  s21_i.reserve(32);
+  s21_i.insert(s21_i.begin() + 1, s21_i.begin(), s21_i.end());
+
+  ASSERT_EQ(s21_v.size(), std_v.size());
+  for (size_t i = 0; i < std_v.size(); ++i) {
+    EXPECT_EQ(s21_v[i], std_v[i]);
+  }
+  std::vector<int> expected{1, 1, 2, 3, 4, 2, 3, 4};
+  ASSERT_EQ(s21_i.size(), expected.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_EQ(s21_i[i], expected[i]);
+  }
+}
+
+struct CopyThrows : CountedValue {
+  // The copy that brings this to zero throws
+  static inline int copies_left = -1;
+
+  CopyThrows() = default;
+  CopyThrows(const CopyThrows& other) : CountedValue(other) {
+    if (--copies_left == 0) {
+      throw std::runtime_error("copy");
+    }
+  }
+  CopyThrows(CopyThrows&&) noexcept = default;
+  CopyThrows& operator=(const CopyThrows&) = default;
+  CopyThrows& operator=(CopyThrows&&) noexcept = default;
+};
+
+TEST(VectorTest, Modifiers_insert_range_copy_throws) {
+  CountedValue::reset();
+  {
+    std::vector<CopyThrows> source(4);
+    s21::Vector<CopyThrows> s21_v;
+    s21_v.reserve(16);
+    for (int i = 0; i < 8; ++i) {
+      s21_v.emplace_back();
+    }
+
+    CopyThrows::copies_left = 3;
+    EXPECT_THROW(
+        s21_v.insert(s21_v.begin() + 2, source.begin(), source.end()),
+        std::runtime_error);
+    CopyThrows::copies_left = -1;
+    EXPECT_EQ(s21_v.size(), 8);
+    EXPECT_EQ(s21_v.capacity(), 16);
+
+    s21_v.insert(s21_v.begin() + 2, source.begin(), source.end());
+    EXPECT_EQ(s21_v.size(), 12);
+  }
+  EXPECT_EQ(CountedValue::constructed, CountedValue::destroyed);
+}
+
+TEST(VectorTest, Trivially_copyable_struct) {
+  struct Point {
+    int x;
+    double y;
+  };
+  s21::Vector<Point> s21_v(1000, Point{3, 0.25});
+  s21_v.insert_many(s21_v.begin() + 10, Point{1, 1.0}, Point{2, 2.0});
+  s21_v.erase(s21_v.begin(), s21_v.begin() + 5);
+  s21::Vector<Point> s21_copy(s21_v);
+  s21_copy.shrink_to_fit();
+
+  ASSERT_EQ(s21_copy.size(), 997);
+  EXPECT_EQ(s21_copy[4].x, 3);
+  EXPECT_EQ(s21_copy[5].x, 1);
+  EXPECT_EQ(s21_copy[6].y, 2.0);
+  EXPECT_EQ(s21_copy[996].y, 0.25);
+}
+
+TEST(VectorTest, Fill_constructor_values) {
+  s21::Vector<int> zeros(100);
+  s21::Vector<int> pattern(100, 0x0A0B0C0D);
+  s21::Vector<char> chars(100, 'z');
+
+  EXPECT_EQ(zeros[99], 0);
+  EXPECT_EQ(pattern[50], 0x0A0B0C0D);
+  EXPECT_EQ(chars[0], 'z');
+  EXPECT_TRUE(s21::has_uniform_bytes(-1));
+  EXPECT_FALSE(s21::has_uniform_bytes(0x0A0B0C0D));
+}
+
+TEST(VectorTest, Custom_allocator) {
+  CountingAllocator<std::string>::allocations = 0;
+  s21::Vector<std::string, CountingAllocator<std::string>> s21_v;
+  s21_v.reserve(16);
+  for (int i = 0; i < 16; ++i) {
+    s21_v.push_back(std::to_string(i));
+  }
+
+  EXPECT_EQ(CountingAllocator<std::string>::allocations, 1);
+  EXPECT_EQ(s21_v.size(), 16);
+  EXPECT_EQ(s21_v.at(15), "15");
+}
+
+// SMALL VECTOR
+TEST(SmallVectorTest, Stays_inline_up_to_N) {
+  s21::SmallVector<int, 4> s21_v{1, 2, 3};
+  s21_v.push_back(4);
+
+  EXPECT_TRUE(s21_v.is_inline());
+  EXPECT_EQ(s21_v.capacity(), 4);
+  EXPECT_EQ(s21_v.size(), 4);
+  EXPECT_EQ(s21_v[3], 4);
+}
+
+TEST(SmallVectorTest, Spills_to_heap) {
+  s21::SmallVector<std::string, 2> s21_v{"a", "b"};
+  s21_v.push_back("c");
+  s21_v.insert_many_back("d", "e");
+
+  EXPECT_FALSE(s21_v.is_inline());
+  EXPECT_EQ(s21_v.size(), 5);
+  EXPECT_EQ(s21_v.at(0), "a");
+  EXPECT_EQ(s21_v.at(4), "e");
+
+  s21_v.erase(s21_v.begin());
+  s21_v.pop_back();
+  s21_v.pop_back();
+  s21_v.shrink_to_fit();
+  EXPECT_TRUE(s21_v.is_inline());
+  EXPECT_EQ(s21_v.at(0), "b");
+  EXPECT_EQ(s21_v.at(1), "c");
+}
+
+TEST(SmallVectorTest, Insert_many) {
+  s21::SmallVector<int, 8> s21_v{1, 5, 6};
+  std::vector<int> std_v{1, 2, 3, 4, 5, 6};
+
+  auto it = s21_v.insert_many(s21_v.begin() + 1, 2, 3, 4);
+
+  EXPECT_EQ(*it, 2);
+  ASSERT_EQ(s21_v.size(), std_v.size());
+  size_t i = 0;
+  for (auto el : s21_v) {
+    EXPECT_EQ(el, std_v[i++]);
+  }
+}
+
+TEST(SmallVectorTest, Copy_and_move) {
+  s21::SmallVector<std::string, 2> small{"x"};
+  s21::SmallVector<std::string, 2> large{"a", "b", "c"};
+
+  s21::SmallVector<std::string, 2> small_copy(small);
+  s21::SmallVector<std::string, 2> large_copy(large);
+  EXPECT_EQ(small_copy.at(0), "x");
+  EXPECT_EQ(large_copy.at(2), "c");
+
+  s21::SmallVector<std::string, 2> small_moved(std::move(small));
+  s21::SmallVector<std::string, 2> large_moved(std::move(large));
+  EXPECT_TRUE(small.empty());
+  EXPECT_TRUE(large.empty());
+  EXPECT_TRUE(large.is_inline());
+  EXPECT_EQ(small_moved.at(0), "x");
+  EXPECT_EQ(large_moved.at(2), "c");
+
+  small_moved = large_copy;
+  EXPECT_EQ(small_moved.size(), 3);
+  large_moved = std::move(small_copy);
+  EXPECT_EQ(large_moved.size(), 1);
+  EXPECT_EQ(large_moved.at(0), "x");
+}
+
+TEST(SmallVectorTest, Swap_inline_and_heap) {
+  s21::SmallVector<int, 2> s21_a{1};
+  s21::SmallVector<int, 2> s21_b{2, 3, 4};
+
+  s21_a.swap(s21_b);
+
+  EXPECT_EQ(s21_a.size(), 3);
+  EXPECT_EQ(s21_a.at(2), 4);
+  EXPECT_EQ(s21_b.size(), 1);
+  EXPECT_EQ(s21_b.at(0), 1);
+}
+
+TEST(SmallVectorTest, Range_insert_and_erase) {
+  std::vector<std::string> source{"x", "y", "z"};
+  s21::SmallVector<std::string, 4> s21_v{"a", "b"};
+
+  s21_v.insert(s21_v.begin() + 1, source.begin(), source.end());
+  EXPECT_FALSE(s21_v.is_inline());
+  auto it = s21_v.erase(s21_v.begin(), s21_v.begin() + 2);
+
+  EXPECT_EQ(*it, "y");
+  ASSERT_EQ(s21_v.size(), 3);
+  EXPECT_EQ(s21_v[2], "b");
+}
+
+TEST(SmallVectorTest, Insert_own_elements) {
+  s21::SmallVector<std::string, 16> s21_v{"a", "b", "c"};
+  std::vector<std::string> std_v{"a", "b", "c"};
+
+  s21_v.insert(s21_v.begin(), s21_v[2]);
+  std_v.insert(std_v.begin(), std_v[2]);
+  s21_v.insert_many(s21_v.begin() + 1, s21_v[3], s21_v[0]);
+  std_v.insert(std_v.begin() + 1, {std_v[3], std_v[0]});
+  s21_v.insert(s21_v.begin(), s21_v.begin() + 2, s21_v.end());
+  std::vector<std::string> tail(std_v.begin() + 2, std_v.end());
+  std_v.insert(std_v.begin(), tail.begin(), tail.end());
+
+  EXPECT_TRUE(s21_v.is_inline());
+  ASSERT_EQ(s21_v.size(), std_v.size());
+  for (size_t i = 0; i < std_v.size(); ++i) {
+    EXPECT_EQ(s21_v[i], std_v[i]);
+  }
+}
+
+TEST(SmallVectorTest, Destroys_every_element) {
+  CountedValue::reset();
+  {
+    s21::SmallVector<CountedValue, 4> s21_v(3);
+    s21::SmallVector<CountedValue, 4> s21_copy(s21_v);
+    s21_v.emplace_back();
+    s21_v.emplace_back();
+    s21_v.emplace(s21_v.begin());
+    s21_copy = std::move(s21_v);
+    s21_v.clear();
+  }
+  EXPECT_EQ(CountedValue::constructed, CountedValue::destroyed);
+}
+
+// ALGO
+// Deterministic inputs covering every tail length around the vector widths
+s21::Vector<int32_t> MakeInts(size_t size, uint32_t seed) {
+  s21::Vector<int32_t> result;
+  for (size_t i = 0; i < size; ++i) {
+    seed = seed * 1664525u + 1013904223u;
+    result.push_back(int32_t(seed) >> 8);
+  }
+  return result;
+}
+
+s21::Vector<float> MakeFloats(size_t size, uint32_t seed) {
+  s21::Vector<float> result;
+  for (size_t i = 0; i < size; ++i) {
+    seed = seed * 1664525u + 1013904223u;
+    result.push_back(float(seed >> 8) / 65536.0f - 128.0f);
+  }
+  return result;
+}
+
+TEST(AlgoTest, Matches_scalar_ints) {
+  for (size_t size = 1; size < 70; ++size) {
+    auto a = MakeInts(size, uint32_t(size));
+    auto b = MakeInts(size, uint32_t(size) + 7);
+    namespace scalar = s21::algo::detail::scalar;
+
+    EXPECT_EQ(s21::algo::find(a, a[size / 2]), scalar::find(a.data(), size,
+                                                            a[size / 2]));
+    EXPECT_EQ(s21::algo::find(a, 1 << 30), size);
+    EXPECT_EQ(s21::algo::count(a, a[size - 1]),
+              scalar::count(a.data(), size, a[size - 1]));
+    EXPECT_EQ(s21::algo::min_value(a), scalar::min_value(a.data(), size));
+    EXPECT_EQ(s21::algo::max_value(a), scalar::max_value(a.data(), size));
+    EXPECT_EQ(s21::algo::sum(a), scalar::sum(a.data(), size));
+    EXPECT_EQ(s21::algo::dot(a, b), scalar::dot(a.data(), b.data(), size));
+  }
+}
+
+TEST(AlgoTest, Matches_scalar_floats) {
+  for (size_t size = 1; size < 70; ++size) {
+    auto a = MakeFloats(size, uint32_t(size));
+    auto b = MakeFloats(size, uint32_t(size) + 7);
+    namespace scalar = s21::algo::detail::scalar;
+
+    EXPECT_EQ(s21::algo::find(a, a[size / 2]), scalar::find(a.data(), size,
+                                                            a[size / 2]));
+    EXPECT_EQ(s21::algo::find(a, 1000.0f), size);
+    EXPECT_EQ(s21::algo::count(a, a[0]), scalar::count(a.data(), size, a[0]));
+    EXPECT_EQ(s21::algo::min_value(a), scalar::min_value(a.data(), size));
+    EXPECT_EQ(s21::algo::max_value(a), scalar::max_value(a.data(), size));
+    EXPECT_NEAR(s21::algo::sum(a), scalar::sum(a.data(), size), 1e-2);
+    EXPECT_NEAR(s21::algo::dot(a, b), scalar::dot(a.data(), b.data(), size),
+                1.0);
+  }
+}
+
+#if S21_ALGO_X86
+TEST(AlgoTest, Every_kernel_matches_scalar) {
+  namespace detail = s21::algo::detail;
+  auto a = MakeInts(1027, 1);
+  auto b = MakeInts(1027, 2);
+  a[1000] = 42;
+  a[1010] = 42;
+  const int32_t* x = a.data();
+  const int32_t* y = b.data();
+
+  EXPECT_EQ(detail::sse2::find(x, a.size(), 42), 1000);
+  EXPECT_EQ(detail::sse2::count(x, a.size(), 42),
+            detail::scalar::count(x, a.size(), 42));
+  EXPECT_EQ(detail::sse2::min_value(x, a.size()),
+            detail::scalar::min_value(x, a.size()));
+  EXPECT_EQ(detail::sse2::max_value(x, a.size()),
+            detail::scalar::max_value(x, a.size()));
+  EXPECT_EQ(detail::sse2::sum(x, a.size()), detail::scalar::sum(x, a.size()));
+  EXPECT_EQ(detail::sse2::dot(x, y, a.size()),
+            detail::scalar::dot(x, y, a.size()));
+
+  if (detail::has_avx2()) {
+    EXPECT_EQ(detail::avx2::find(x, a.size(), 42), 1000);
+    EXPECT_EQ(detail::avx2::count(x, a.size(), 42),
+              detail::scalar::count(x, a.size(), 42));
+    EXPECT_EQ(detail::avx2::min_value(x, a.size()),
+              detail::scalar::min_value(x, a.size()));
+    EXPECT_EQ(detail::avx2::max_value(x, a.size()),
+              detail::scalar::max_value(x, a.size()));
+    EXPECT_EQ(detail::avx2::sum(x, a.size()),
+              detail::scalar::sum(x, a.size()));
+    EXPECT_EQ(detail::avx2::dot(x, y, a.size()),
+              detail::scalar::dot(x, y, a.size()));
+  }
+}
+#endif
+
+TEST(AlgoTest, Extreme_ints) {
+  s21::Vector<int32_t> s21_v(37, INT32_MIN);
+  s21::Vector<int32_t> s21_w(37, -3);
+  s21_v[20] = INT32_MAX;
+  s21_w[20] = 5;
+
+  EXPECT_EQ(s21::algo::min_value(s21_v), INT32_MIN);
+  EXPECT_EQ(s21::algo::max_value(s21_v), INT32_MAX);
+  EXPECT_EQ(s21::algo::sum(s21_v), 36LL * INT32_MIN + INT32_MAX);
+  EXPECT_EQ(s21::algo::dot(s21_v, s21_w),
+            -3LL * 36 * INT32_MIN + 5LL * INT32_MAX);
+}
+
+TEST(AlgoTest, Array_and_other_types) {
+  s21::Array<int32_t, 9> s21_a{5, 3, 9, 3, 1, 8, 3, 7, 2};
+  s21::Vector<double> s21_d{1.5, -2.0, 4.0};
+
+  EXPECT_EQ(s21::algo::find(s21_a, 1), 4);
+  EXPECT_EQ(s21::algo::count(s21_a, 3), 3);
+  EXPECT_EQ(s21::algo::min_value(s21_a), 1);
+  EXPECT_EQ(s21::algo::sum(s21_a), 41);
+  EXPECT_EQ(s21::algo::max_value(s21_d), 4.0);
+  EXPECT_EQ(s21::algo::dot(s21_d, s21_d), 22.25);
+}
+
+TEST(AlgoTest, Empty_ranges) {
+  s21::Vector<int32_t> s21_empty;
+  s21::Vector<int32_t> s21_other{1};
+
+  EXPECT_EQ(s21::algo::find(s21_empty, 1), 0);
+  EXPECT_EQ(s21::algo::count(s21_empty, 1), 0);
+  EXPECT_EQ(s21::algo::sum(s21_empty), 0);
+  EXPECT_THROW(s21::algo::min_value(s21_empty), std::out_of_range);
+  EXPECT_THROW(s21::algo::max_value(s21_empty), std::out_of_range);
+  EXPECT_THROW(s21::algo::dot(s21_empty, s21_other), std::invalid_argument);
+}
+
 // STACK
 TEST(StackTest, Constructor_default) {
   s21::stack<int> s21_stack;
@@ -1398,75 +2128,921 @@ TEST(ListTest, Erase_3) {
   EXPECT_TRUE(compare_lists(my_list1, std_list1));
 }
 
-// // // QUEUE
+TEST(ListTest, Pool_reuses_freed_nodes) {
+  using node_allocator = CountingAllocator<s21::ListNode<int>>;
+  s21::List<int, CountingAllocator<int>> s21_list;
+  node_allocator::allocations = 0;
 
-template <typename value_type>
-bool compare_queues(s21::queue<value_type> my_queue,
-                    std::queue<value_type> std_queue) {
-  bool result = true;
-  if (my_queue.size() == std_queue.size()) {
-    while (!my_queue.empty() && !std_queue.empty()) {
-      if (my_queue.front() != std_queue.front()) {
-        result = false;
-        break;
-      }
-      my_queue.pop();
-      std_queue.pop();
-    }
-  } else {
-    result = false;
+  for (int i = 0; i < 100; ++i) {
+    s21_list.push_back(i);
   }
-  return result;
-}
+  int slabs = node_allocator::allocations;
+  EXPECT_LT(slabs, 10);
 
-TEST(QueueTest, CompareQueues) {
-  s21::queue<int> my_queue{1, 3, 10, -5, 20};
-  std::queue<int> std_queue;
-  std_queue.push(1);
-  std_queue.push(3);
-  std_queue.push(10);
-  std_queue.push(-5);
-  std_queue.push(20);
-  EXPECT_TRUE(compare_queues(my_queue, std_queue));
-  std_queue.push(20);
-  EXPECT_FALSE(compare_queues(my_queue, std_queue));
+  while (!s21_list.empty()) {
+    s21_list.pop_front();
+  }
+  for (int i = 0; i < 100; ++i) {
+    s21_list.push_front(i);
+  }
+  EXPECT_EQ(node_allocator::allocations, slabs);
+  EXPECT_EQ(s21_list.front(), 99);
+  EXPECT_EQ(s21_list.back(), 0);
+}
+
+TEST(ListTest, Destroys_every_element) {
+  CountedValue::reset();
+  {
+    s21::List<CountedValue> s21_list(5);
+    s21::List<CountedValue> s21_copy(s21_list);
+    s21_list.push_back(CountedValue());
+    s21_list.erase(++s21_list.begin());
+    s21_list.pop_front();
+    s21::List<CountedValue> s21_moved(std::move(s21_list));
+    s21_copy = s21_moved;
+    s21_moved.clear();
+    s21_moved.push_front(CountedValue());
+  }
+  EXPECT_EQ(CountedValue::constructed, CountedValue::destroyed);
 }
 
-TEST(QueueTest, CompareQueues_2) {
-  s21::queue<int> my_queue{1, 3, 10, -5, 20};
-  std::queue<int> std_queue;
-  std_queue.push(1);
-  std_queue.push(3);
-  std_queue.push(10);
-  std_queue.push(-5);
-  std_queue.push(100);
-  EXPECT_FALSE(compare_queues(my_queue, std_queue));
+TEST(ListTest, Insert_many_keeps_order) {
+  s21::List<int> s21_list{1, 5};
+  std::list<int> std_list{1, 2, 3, 4, 5};
+
+  auto it = s21_list.insert_many(++s21_list.cbegin(), 2, 3, 4);
+  s21_list.insert_many_back(6, 7);
+  std_list.push_back(6);
+  std_list.push_back(7);
+
+  EXPECT_EQ(*it, 2);
+  EXPECT_TRUE(compare_lists(s21_list, std_list));
 }
 
-TEST(QueueTest, DefaultConstructor) {
-  s21::queue<int> my_queue;
-  std::queue<int> std_queue;
-  EXPECT_EQ(my_queue.size(), 0);
-  EXPECT_TRUE(my_queue.empty());
-  EXPECT_TRUE(compare_queues(my_queue, std_queue));
+TEST(ListTest, Unique_updates_size) {
+  s21::List<int> s21_list{1, 1, 2, 2, 2, 3, 1, 1};
+  std::list<int> std_list{1, 1, 2, 2, 2, 3, 1, 1};
+  s21_list.unique();
+  std_list.unique();
+
+  EXPECT_TRUE(compare_lists(s21_list, std_list));
 }
 
-TEST(QueueTest, InitializerqueueConstructor) {
-  s21::queue<int> my_queue{1, 2, 3, 7, 9};
-  std::initializer_list<int> il = {1, 2, 3, 7, 9};
-  std::queue<int> std_queue{il};
-  EXPECT_TRUE(compare_queues(my_queue, std_queue));
+TEST(ListTest, Swap_and_move_keep_links) {
+  s21::List<int> s21_a{1, 2, 3};
+  s21::List<int> s21_b;
+  s21_a.swap(s21_b);
+  s21_b.push_front(0);
+  s21_a.push_back(9);
+
+  EXPECT_TRUE(compare_lists(s21_a, std::list<int>{9}));
+  EXPECT_TRUE(compare_lists(s21_b, std::list<int>{0, 1, 2, 3}));
+
+  s21::List<int> s21_c(std::move(s21_b));
+  s21_c.pop_back();
+  s21_b.push_back(4);
+  EXPECT_TRUE(compare_lists(s21_c, std::list<int>{0, 1, 2}));
+  EXPECT_TRUE(compare_lists(s21_b, std::list<int>{4}));
+  EXPECT_EQ(*--s21_c.end(), 2);
 }
 
-TEST(QueueTest, InitializerqueueConstructor_2) {
-  std::initializer_list<int> b;
-  s21::queue<int> my_queue{b};
-  std::queue<int> std_queue{b};
-  EXPECT_TRUE(compare_queues(my_queue, std_queue));
+TEST(ListTest, Sort_matches_std) {
+  s21::List<int> s21_list;
+  std::list<int> std_list;
+  for (int i = 0; i < 1000; ++i) {
+    s21_list.push_back(i * 7919 % 257);
+    std_list.push_back(i * 7919 % 257);
+  }
+  s21_list.sort();
+  std_list.sort();
+  EXPECT_TRUE(compare_lists(s21_list, std_list));
+
+  s21_list.sort([](int a, int b) { return a > b; });
+  std_list.sort([](int a, int b) { return a > b; });
+  EXPECT_TRUE(compare_lists(s21_list, std_list));
+  EXPECT_EQ(*--s21_list.end(), 0);
 }
 
-TEST(QueueTest, CopyConstructor) {
-  s21::queue<int> my_queue{1, 2, 3, 7, 9};
+TEST(ListTest, Sort_is_stable) {
+  s21::List<std::pair<int, int>> s21_list;
+  for (int i = 0; i < 100; ++i) {
+    s21_list.push_back({i % 3, i});
+  }
+  s21_list.sort([](const auto& a, const auto& b) { return a.first < b.first; });
+
+  auto prev = s21_list.front();
+  for (const auto& el : s21_list) {
+    EXPECT_TRUE(prev.first < el.first ||
+                (prev.first == el.first && prev.second <= el.second));
+    prev = el;
+  }
+}
+
+TEST(ListTest, Sort_relinks_without_copies) {
+  struct Keyed {
+    int key;
+    CountedValue counter;
+  };
+  CountedValue::reset();
+  {
+    s21::List<Keyed> s21_list;
+    for (int i = 0; i < 64; ++i) {
+      s21_list.push_back({63 - i, {}});
+    }
+    std::map<int, const Keyed*> addresses;
+    for (const auto& el : s21_list) {
+      addresses[el.key] = &el;
+    }
+    int constructed = CountedValue::constructed;
+
+    s21_list.sort([](const Keyed& a, const Keyed& b) { return a.key < b.key; });
+    EXPECT_EQ(CountedValue::constructed, constructed);
+    int expected = 0;
+    for (const auto& el : s21_list) {
+      EXPECT_EQ(el.key, expected);
+      EXPECT_EQ(&el, addresses[expected]);
+      ++expected;
+    }
+  }
+  EXPECT_EQ(CountedValue::constructed, CountedValue::destroyed);
+}
+
+TEST(ListTest, Sort_keeps_every_node_when_compare_throws) {
+  CountedValue::reset();
+  {
+    s21::List<CountedValue> s21_list(100);
+    int calls = 0;
+    EXPECT_THROW(s21_list.sort([&](const CountedValue&, const CountedValue&) {
+      if (++calls == 150) {
+        throw std::runtime_error("compare");
+      }
+      return false;
+    }),
+                 std::runtime_error);
+    EXPECT_EQ(s21_list.size(), 100U);
+    EXPECT_EQ(size_t(std::distance(s21_list.begin(), s21_list.end())), 100U);
+    size_t backwards = 0;
+    for (auto it = s21_list.end(); it != s21_list.begin(); --it) {
+      ++backwards;
+    }
+    EXPECT_EQ(backwards, 100U);
+  }
+  EXPECT_EQ(CountedValue::constructed, CountedValue::destroyed);
+}
+
+TEST(ListTest, Sort_survives_a_throw_on_every_compare) {
+  auto make_list = [](int n) {
+    s21::List<int> s21_list;
+    for (int i = 0; i < n; ++i) {
+      s21_list.push_back((i * 3) % n);
+    }
+    return s21_list;
+  };
+
+  for (int n : {5, 7, 13}) {
+    int total = 0;
+    make_list(n).sort([&](int a, int b) {
+      ++total;
+      return a < b;
+    });
+
+    for (int throw_at = 1; throw_at <= total; ++throw_at) {
+      s21::List<int> s21_list = make_list(n);
+      int calls = 0;
+      EXPECT_THROW(s21_list.sort([&](int a, int b) {
+        if (++calls == throw_at) {
+          throw std::runtime_error("compare");
+        }
+        return a < b;
+      }),
+                   std::runtime_error);
+      EXPECT_EQ(s21_list.size(), size_t(n));
+      EXPECT_EQ(std::distance(s21_list.begin(), s21_list.end()), n);
+      int backwards = 0;
+      for (auto it = s21_list.end(); it != s21_list.begin(); --it) {
+        ++backwards;
+      }
+      EXPECT_EQ(backwards, n);
+      std::vector<int> values(s21_list.begin(), s21_list.end());
+      std::sort(values.begin(), values.end());
+      for (int i = 0; i < n; ++i) {
+        EXPECT_EQ(values[i], i);
+      }
+    }
+  }
+}
+
+TEST(ListTest, Merge_relinks_without_allocating) {
+  using node_allocator = CountingAllocator<s21::ListNode<int>>;
+  s21::List<int, CountingAllocator<int>> s21_a;
+  s21::List<int, CountingAllocator<int>> s21_b;
+  std::list<int> std_list;
+  for (int i = 0; i < 200; ++i) {
+    (i % 3 ? s21_a : s21_b).push_back(i);
+    std_list.push_back(i);
+  }
+  const int* first_b = &s21_b.front();
+  node_allocator::allocations = 0;
+
+  s21_a.merge(s21_b);
+  EXPECT_EQ(node_allocator::allocations, 0);
+  EXPECT_TRUE(s21_b.empty());
+  EXPECT_TRUE(s21_b.begin() == s21_b.end());
+  EXPECT_EQ(&*s21_a.begin(), first_b);
+  EXPECT_TRUE(std::equal(s21_a.begin(), s21_a.end(), std_list.begin(),
+                         std_list.end()));
+}
+
+TEST(ListTest, Merge_with_comparator_is_stable) {
+  using item = std::pair<int, char>;
+  s21::List<item> s21_a{{5, 'a'}, {3, 'a'}, {1, 'a'}};
+  s21::List<item> s21_b{{6, 'b'}, {3, 'b'}, {0, 'b'}};
+  s21_a.merge(s21_b, [](const item& x, const item& y) {
+    return x.first > y.first;
+  });
+
+  std::list<item> expected{{6, 'b'}, {5, 'a'}, {3, 'a'},
+                           {3, 'b'}, {1, 'a'}, {0, 'b'}};
+  EXPECT_TRUE(compare_lists(s21_a, expected));
+  EXPECT_EQ(s21_a.size(), 6U);
+  EXPECT_EQ(s21_b.size(), 0U);
+}
+
+TEST(ListTest, Merged_nodes_outlive_source_list) {
+  CountedValue::reset();
+  {
+    s21::List<std::pair<int, CountedValue>> s21_a;
+    s21_a.push_back({2, {}});
+    {
+      s21::List<std::pair<int, CountedValue>> s21_b;
+      for (int i = 0; i < 50; ++i) {
+        s21_b.push_back({i * 2 + 1, {}});
+      }
+      s21_a.merge(s21_b, [](const auto& x, const auto& y) {
+        return x.first < y.first;
+      });
+      s21_b.push_back({-1, {}});
+      EXPECT_EQ(s21_b.size(), 1U);
+    }
+    s21_a.erase(s21_a.begin());
+    s21_a.push_front({0, {}});
+    EXPECT_EQ(s21_a.size(), 51U);
+    EXPECT_EQ(s21_a.back().first, 99);
+  }
+  EXPECT_EQ(CountedValue::constructed, CountedValue::destroyed);
+}
+
+TEST(ListTest, Merge_chains_share_pools) {
+  auto s21_a = std::make_unique<s21::List<int>>(s21::List<int>{1, 4, 7});
+  auto s21_b = std::make_unique<s21::List<int>>(s21::List<int>{2, 5, 8});
+  s21::List<int> s21_c{3, 6, 9};
+
+  s21_a->merge(*s21_b);
+  for (int i = 0; i < 100; ++i) {
+    s21_b->push_back(10 + i);
+  }
+  s21_c.merge(*s21_b);
+  s21_b.reset();
+  s21_c.merge(*s21_a);
+  s21_a.reset();
+
+  EXPECT_EQ(s21_c.size(), 109U);
+  int expected = 1;
+  for (int el : s21_c) {
+    EXPECT_EQ(el, expected++);
+  }
+}
+
+TEST(ListTest, Merged_nodes_do_not_pin_slabs) {
+  using list = s21::List<int, CountingAllocator<int>>;
+  using node_allocator = CountingAllocator<s21::ListNode<int>>;
+  int live = node_allocator::live;
+  {
+    list s21_keep{-1};
+    auto round = [&](int i) {
+      list s21_batch;
+      for (int j = 0; j < 10; ++j) {
+        s21_batch.push_back(i + j);
+      }
+      s21_keep.merge(s21_batch);
+      for (int j = 0; j < 10; ++j) {
+        s21_keep.pop_back();
+      }
+    };
+
+    for (int i = 0; i < 100; ++i) {
+      round(i);
+    }
+    int kept = node_allocator::live;
+    for (int i = 0; i < 20000; ++i) {
+      round(i);
+    }
+    EXPECT_EQ(node_allocator::live, kept);
+    EXPECT_EQ(s21_keep.size(), 1U);
+  }
+  EXPECT_EQ(node_allocator::live, live);
+}
+
+TEST(ListTest, Merged_lists_on_separate_threads) {
+  s21::List<int> s21_a{1, 3, 5};
+  s21::List<int> s21_b{2, 4};
+  s21_b.merge(s21_a);
+  s21_a.push_back(0);
+
+  std::thread t_b([&] {
+    for (int i = 0; i < 20000; ++i) {
+      s21_b.pop_front();
+      s21_b.push_back(i);
+    }
+  });
+  for (int i = 0; i < 20000; ++i) {
+    s21_a.push_back(i);
+    s21_a.pop_front();
+  }
+  t_b.join();
+
+  EXPECT_EQ(s21_a.size(), 1U);
+  EXPECT_EQ(s21_b.size(), 5U);
+  EXPECT_EQ(s21_b.back(), 19999);
+}
+
+TEST(ListTest, Splice_steals_nodes) {
+  using node_allocator = CountingAllocator<s21::ListNode<int>>;
+  s21::List<int, CountingAllocator<int>> s21_a{1, 5};
+  s21::List<int, CountingAllocator<int>> s21_b{2, 3, 4};
+  const int* first_b = &s21_b.front();
+  node_allocator::allocations = 0;
+
+  s21_a.splice(++s21_a.begin(), s21_b);
+  EXPECT_EQ(node_allocator::allocations, 0);
+  EXPECT_TRUE(s21_b.empty());
+  EXPECT_EQ(&*++s21_a.begin(), first_b);
+
+  std::list<int> expected{1, 2, 3, 4, 5};
+  EXPECT_TRUE(std::equal(s21_a.begin(), s21_a.end(), expected.begin(),
+                         expected.end()));
+  EXPECT_EQ(s21_a.size(), 5U);
+}
+
+TEST(ListTest, Splice_one_element) {
+  s21::List<int> s21_a{1, 2, 3};
+  s21::List<int> s21_b{10, 20, 30};
+  std::list<int> std_a{1, 2, 3};
+  std::list<int> std_b{10, 20, 30};
+
+  s21_a.splice(s21_a.end(), s21_b, ++s21_b.begin());
+  std_a.splice(std_a.end(), std_b, ++std_b.begin());
+  EXPECT_TRUE(compare_lists(s21_a, std_a));
+  EXPECT_TRUE(compare_lists(s21_b, std_b));
+
+  // Within one list, and onto its own position
+  s21_a.splice(s21_a.begin(), s21_a, --s21_a.end());
+  std_a.splice(std_a.begin(), std_a, --std_a.end());
+  s21_a.splice(s21_a.begin(), s21_a, s21_a.begin());
+  EXPECT_TRUE(compare_lists(s21_a, std_a));
+  EXPECT_EQ(s21_a.size(), 4U);
+}
+
+TEST(ListTest, Splice_range) {
+  s21::List<int> s21_a{1, 2, 3};
+  s21::List<int> s21_b{10, 20, 30, 40};
+  std::list<int> std_a{1, 2, 3};
+  std::list<int> std_b{10, 20, 30, 40};
+
+  s21_a.splice(++s21_a.begin(), s21_b, ++s21_b.begin(), --s21_b.end());
+  std_a.splice(++std_a.begin(), std_b, ++std_b.begin(), --std_b.end());
+  EXPECT_TRUE(compare_lists(s21_a, std_a));
+  EXPECT_TRUE(compare_lists(s21_b, std_b));
+
+  s21_a.splice(s21_a.end(), s21_a, s21_a.begin(), ++++s21_a.begin());
+  std_a.splice(std_a.end(), std_a, std_a.begin(), ++++std_a.begin());
+  s21_a.splice(s21_a.end(), s21_b, s21_b.begin(), s21_b.end());
+  std_a.splice(std_a.end(), std_b, std_b.begin(), std_b.end());
+  EXPECT_TRUE(compare_lists(s21_a, std_a));
+  EXPECT_TRUE(s21_b.empty());
+}
+
+TEST(ListTest, Clear_long_list_and_reuse) {
+  CountedValue::reset();
+  {
+    s21::List<CountedValue> s21_list(1000000);
+    int destroyed = CountedValue::destroyed;
+    s21_list.clear();
+    EXPECT_TRUE(s21_list.empty());
+    EXPECT_EQ(CountedValue::destroyed - destroyed, 1000000);
+
+    s21_list.insert_many_back(CountedValue{}, CountedValue{});
+    EXPECT_EQ(s21_list.size(), 2U);
+  }
+  EXPECT_EQ(CountedValue::constructed, CountedValue::destroyed);
+}
+
+// Nodes that keep moving from one list to another are freed by the
+// receiving list; the producing list must get them back instead of
+// carving new slabs
+TEST(ListTest, Node_churn_between_lists_stays_flat) {
+  using node_allocator = CountingAllocator<s21::ListNode<int>>;
+  s21::List<int, CountingAllocator<int>> s21_a;
+  s21::List<int, CountingAllocator<int>> s21_b;
+  auto cycle = [&](int i) {
+    s21_a.push_back(i);
+    s21_a.push_back(i + 1);
+    switch (i % 4) {
+      case 0:
+        s21_b.splice(s21_b.end(), s21_a);
+        s21_b.pop_front();
+        s21_b.pop_front();
+        break;
+      case 1:
+        s21_b.merge(s21_a);
+        s21_b.clear();
+        break;
+      case 2:
+        s21_b.splice(s21_b.begin(), s21_a, s21_a.begin());
+        s21_b.splice(s21_b.begin(), s21_a, s21_a.begin(), s21_a.end());
+        s21_b.pop_back();
+        s21_b.pop_back();
+        break;
+      default:
+        s21_a.splice(s21_a.begin(), s21_b);
+        s21_a.clear();
+        break;
+    }
+  };
+
+  for (int i = 0; i < 1000; ++i) {
+    cycle(i);
+  }
+  int allocations = node_allocator::allocations;
+  for (int i = 0; i < 100000; ++i) {
+    cycle(i);
+  }
+  EXPECT_EQ(node_allocator::allocations, allocations);
+  EXPECT_TRUE(s21_a.empty());
+  EXPECT_TRUE(s21_b.empty());
+}
+
+// A node freed by the list it was spliced into goes back to its own slab,
+// so slabs of lists that are gone are freed instead of piling up in the
+// list that kept their nodes
+TEST(ListTest, Spliced_nodes_do_not_pin_slabs) {
+  using list = s21::List<int, CountingAllocator<int>>;
+  using node_allocator = CountingAllocator<s21::ListNode<int>>;
+  int live = node_allocator::live;
+  {
+    list s21_keep{-1};
+    auto round = [&](int i) {
+      list s21_batch;
+      for (int j = 0; j < 10; ++j) {
+        s21_batch.push_back(i + j);
+      }
+      switch (i % 3) {
+        case 0:
+          s21_keep.splice(s21_keep.end(), s21_batch);
+          break;
+        case 1:
+          s21_keep.splice(s21_keep.end(), s21_batch, s21_batch.begin(),
+                          s21_batch.end());
+          break;
+        default:
+          while (!s21_batch.empty()) {
+            s21_keep.splice(s21_keep.end(), s21_batch, s21_batch.begin());
+          }
+          break;
+      }
+      for (int j = 0; j < 10; ++j) {
+        s21_keep.pop_back();
+      }
+    };
+
+    for (int i = 0; i < 100; ++i) {
+      round(i);
+    }
+    int kept = node_allocator::live;
+    for (int i = 0; i < 20000; ++i) {
+      round(i);
+    }
+    EXPECT_EQ(node_allocator::live, kept);
+    EXPECT_EQ(s21_keep.size(), 1U);
+    EXPECT_EQ(s21_keep.front(), -1);
+  }
+  EXPECT_EQ(node_allocator::live, live);
+}
+
+TEST(ListTest, Spliced_lists_on_separate_threads) {
+  s21::List<int> s21_a{1, 2, 3};
+  s21::List<int> s21_b{4, 5};
+  s21_b.splice(s21_b.cend(), s21_a, s21_a.cbegin());
+  s21_b.splice(s21_b.cbegin(), s21_a, s21_a.cbegin(), s21_a.cend());
+  s21_a.splice(s21_a.cend(), s21_b, s21_b.cbegin());
+
+  auto churn = [](s21::List<int>* list) {
+    for (int i = 0; i < 20000; ++i) {
+      list->push_back(i);
+      list->pop_front();
+    }
+  };
+  std::thread t_a(churn, &s21_a);
+  std::thread t_b(churn, &s21_b);
+  t_a.join();
+  t_b.join();
+
+  EXPECT_EQ(s21_a.size(), 1U);
+  EXPECT_EQ(s21_b.size(), 4U);
+  EXPECT_EQ(s21_a.back(), 19999);
+  EXPECT_EQ(s21_b.back(), 19999);
+}
+
+TEST(ListTest, Short_lists_share_one_pool) {
+  using node_allocator = CountingAllocator<s21::ListNode<int>>;
+  std::vector<s21::List<int, CountingAllocator<int>>> lists(1000);
+  node_allocator::allocations = 0;
+  for (auto& list : lists) {
+    list.share_pool(lists[0]);
+  }
+  for (int round = 0; round < 3; ++round) {
+    for (size_t i = 0; i < lists.size(); ++i) {
+      lists[i].push_back(int(i));
+    }
+  }
+  EXPECT_LT(node_allocator::allocations, 20);
+
+  int allocations = node_allocator::allocations;
+  for (auto& list : lists) {
+    list.pop_front();
+    list.clear();
+  }
+  for (size_t i = 0; i < lists.size(); ++i) {
+    lists[i].push_back(int(i));
+    lists[lists.size() - 1 - i].splice(lists[lists.size() - 1 - i].end(),
+                                      lists[i]);
+  }
+  EXPECT_EQ(node_allocator::allocations, allocations);
+  EXPECT_EQ(lists[0].size() + lists[999].size(), 2U);
+  EXPECT_EQ(lists[999].front(), 0);
+}
+
+TEST(ListTest, Emplace_constructs_in_place) {
+  s21::List<std::pair<int, std::string>> s21_list;
+  EXPECT_EQ(s21_list.emplace_back(2, "two").second, "two");
+  EXPECT_EQ(s21_list.emplace_front(0, "zero").first, 0);
+  auto it = s21_list.emplace(--s21_list.end(), 1, "one");
+  EXPECT_EQ(it->second, "one");
+
+  std::list<std::pair<int, std::string>> expected{
+      {0, "zero"}, {1, "one"}, {2, "two"}};
+  EXPECT_TRUE(compare_lists(s21_list, expected));
+
+  CountedValue::reset();
+  {
+    s21::List<CountedValue> s21_counted;
+    s21_counted.emplace_back();
+    s21_counted.emplace_front();
+    EXPECT_EQ(CountedValue::constructed, 2);
+  }
+  EXPECT_EQ(CountedValue::destroyed, 2);
+}
+
+TEST(ListTest, Rvalue_push_moves) {
+  s21::List<std::unique_ptr<int>> s21_list;
+  s21_list.push_back(std::make_unique<int>(2));
+  s21_list.push_front(std::make_unique<int>(0));
+  s21_list.insert(--s21_list.end(), std::make_unique<int>(1));
+  s21_list.insert_many_back(std::make_unique<int>(3), std::make_unique<int>(4));
+
+  int expected = 0;
+  for (const auto& el : s21_list) {
+    EXPECT_EQ(*el, expected++);
+  }
+
+  s21::queue<std::unique_ptr<int>> s21_queue;
+  s21_queue.push(std::make_unique<int>(5));
+  s21_queue.emplace(new int(6));
+  EXPECT_EQ(*s21_queue.front(), 5);
+  EXPECT_EQ(*s21_queue.back(), 6);
+}
+
+// // // UNROLLED LIST
+
+template <typename Unrolled, typename Expected>
+bool same_elements(const Unrolled& unrolled, const Expected& expected) {
+  return unrolled.size() == expected.size() &&
+         std::equal(unrolled.begin(), unrolled.end(), expected.begin(),
+                    expected.end());
+}
+
+TEST(UnrolledListTest, Packs_many_elements_per_block) {
+  EXPECT_GE(s21::UnrolledList<int>::block_capacity(), 100U);
+  EXPECT_EQ((s21::UnrolledList<int, 64>::block_capacity()), 10U);
+  EXPECT_EQ((s21::UnrolledList<std::array<char, 100>, 64>::block_capacity()),
+            2U);
+}
+
+TEST(UnrolledListTest, Push_and_pop_both_ends) {
+  s21::UnrolledList<int, 64> s21_list;
+  std::deque<int> std_deque;
+  for (int i = 0; i < 100; ++i) {
+    s21_list.push_back(i);
+    std_deque.push_back(i);
+    s21_list.push_front(-i);
+    std_deque.push_front(-i);
+  }
+  EXPECT_TRUE(same_elements(s21_list, std_deque));
+  EXPECT_EQ(s21_list.front(), -99);
+  EXPECT_EQ(s21_list.back(), 99);
+
+  for (int i = 0; i < 70; ++i) {
+    s21_list.pop_front();
+    std_deque.pop_front();
+    s21_list.pop_back();
+    std_deque.pop_back();
+  }
+  EXPECT_TRUE(same_elements(s21_list, std_deque));
+
+  while (!s21_list.empty()) {
+    s21_list.pop_back();
+  }
+  EXPECT_TRUE(s21_list.begin() == s21_list.end());
+  EXPECT_THROW(s21_list.pop_front(), std::runtime_error);
+  s21_list.push_back(7);
+  EXPECT_EQ(s21_list.front(), 7);
+}
+
+TEST(UnrolledListTest, Iterates_both_ways) {
+  s21::UnrolledList<int, 64> s21_list;
+  for (int i = 0; i < 35; ++i) {
+    s21_list.push_back(i);
+  }
+
+  int expected = 34;
+  for (auto it = s21_list.end(); it != s21_list.begin();) {
+    EXPECT_EQ(*--it, expected--);
+  }
+  EXPECT_EQ(expected, -1);
+
+  const auto& view = s21_list;
+  s21::UnrolledList<int, 64>::const_iterator it = s21_list.begin();
+  EXPECT_TRUE(it == view.cbegin());
+  EXPECT_EQ(std::distance(view.begin(), view.end()), 35);
+}
+
+TEST(UnrolledListTest, Insert_and_erase_in_the_middle) {
+  s21::UnrolledList<int, 64> s21_list;
+  std::list<int> std_list;
+  for (int i = 0; i < 40; ++i) {
+    s21_list.push_back(i);
+    std_list.push_back(i);
+  }
+
+  for (int i = 0; i < 60; ++i) {
+    auto s21_pos = std::next(s21_list.begin(), (i * 7) % s21_list.size());
+    auto std_pos = std::next(std_list.begin(), (i * 7) % std_list.size());
+    EXPECT_EQ(*s21_list.insert(s21_pos, 100 + i), 100 + i);
+    std_list.insert(std_pos, 100 + i);
+  }
+  EXPECT_TRUE(same_elements(s21_list, std_list));
+
+  for (int i = 0; i < 80; ++i) {
+    auto s21_pos = std::next(s21_list.begin(), (i * 5) % s21_list.size());
+    auto std_pos = std::next(std_list.begin(), (i * 5) % std_list.size());
+    auto s21_next = s21_list.erase(s21_pos);
+    auto std_next = std_list.erase(std_pos);
+    EXPECT_EQ(s21_next == s21_list.end(), std_next == std_list.end());
+    if (std_next != std_list.end()) {
+      EXPECT_EQ(*s21_next, *std_next);
+    }
+  }
+  EXPECT_TRUE(same_elements(s21_list, std_list));
+}
+
+TEST(UnrolledListTest, Insert_many) {
+  s21::UnrolledList<int, 64> s21_list{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+  auto it = s21_list.insert_many(std::next(s21_list.begin(), 5), 20, 21, 22);
+  EXPECT_EQ(*it, 20);
+  s21_list.insert_many_back(30, 31);
+  s21_list.insert_many_front(0, -1);
+
+  std::list<int> expected{-1, 0, 1,  2,  3,  4,  5,  20,
+                          21, 22, 6, 7, 8, 9, 10, 30, 31};
+  EXPECT_TRUE(same_elements(s21_list, expected));
+}
+
+TEST(UnrolledListTest, Splice_moves_blocks) {
+  s21::UnrolledList<int, 64> s21_a;
+  s21::UnrolledList<int, 64> s21_b;
+  std::list<int> std_a;
+  std::list<int> std_b;
+  for (int i = 0; i < 25; ++i) {
+    s21_a.push_back(i);
+    std_a.push_back(i);
+    s21_b.push_back(100 + i);
+    std_b.push_back(100 + i);
+  }
+  const int* first_b = &s21_b.front();
+
+  s21_a.splice(std::next(s21_a.begin(), 13), s21_b);
+  std_a.splice(std::next(std_a.begin(), 13), std_b);
+  EXPECT_TRUE(same_elements(s21_a, std_a));
+  EXPECT_TRUE(s21_b.empty());
+  EXPECT_EQ(&*std::next(s21_a.begin(), 13), first_b);
+
+  s21::UnrolledList<int, 64> s21_c{-2, -1};
+  s21_a.splice(s21_a.begin(), s21_c);
+  s21_a.splice(s21_a.end(), s21_c);
+  std_a.push_front(-1);
+  std_a.push_front(-2);
+  EXPECT_TRUE(same_elements(s21_a, std_a));
+}
+
+TEST(UnrolledListTest, Copy_move_and_swap) {
+  s21::UnrolledList<int, 64> s21_a;
+  for (int i = 0; i < 30; ++i) {
+    s21_a.push_back(i);
+  }
+  s21::UnrolledList<int, 64> s21_b(s21_a);
+  s21::UnrolledList<int, 64> s21_c(std::move(s21_a));
+  EXPECT_TRUE(s21_a.empty());
+  EXPECT_TRUE(same_elements(s21_b, s21_c));
+
+  s21_a = s21_c;
+  s21_c.pop_back();
+  s21_a.swap(s21_c);
+  EXPECT_EQ(s21_a.size(), 29U);
+  EXPECT_EQ(s21_c.size(), 30U);
+  s21_b = std::move(s21_a);
+  EXPECT_EQ(s21_b.back(), 28);
+}
+
+TEST(UnrolledListTest, Block_churn_between_lists_stays_flat) {
+  using list = s21::UnrolledList<int, 64, CountingAllocator<int>>;
+  using block_allocator = CountingAllocator<
+      s21::UnrolledListBlock<int, list::block_capacity()>>;
+  list s21_work;
+  list s21_batch;
+  auto cycle = [&](int i) {
+    for (int j = 0; j < 40; ++j) {
+      s21_batch.push_back(i + j);
+    }
+    s21_work.splice(s21_work.end(), s21_batch);
+    s21_work.clear();
+  };
+
+  for (int i = 0; i < 100; ++i) {
+    cycle(i);
+  }
+  int allocations = block_allocator::allocations;
+  for (int i = 0; i < 10000; ++i) {
+    cycle(i);
+  }
+  EXPECT_EQ(block_allocator::allocations, allocations);
+  EXPECT_TRUE(s21_work.empty());
+  EXPECT_TRUE(s21_batch.empty());
+}
+
+TEST(UnrolledListTest, Spliced_blocks_do_not_pin_slabs) {
+  using list = s21::UnrolledList<int, 64, CountingAllocator<int>>;
+  using block_allocator = CountingAllocator<
+      s21::UnrolledListBlock<int, list::block_capacity()>>;
+  int live = block_allocator::live;
+  {
+    list s21_keep{-1};
+    auto round = [&](int i) {
+      list s21_batch;
+      for (int j = 0; j < 40; ++j) {
+        s21_batch.push_back(i + j);
+      }
+      s21_keep.splice(s21_keep.end(), s21_batch);
+      for (int j = 0; j < 40; ++j) {
+        s21_keep.pop_back();
+      }
+    };
+
+    for (int i = 0; i < 100; ++i) {
+      round(i);
+    }
+    int kept = block_allocator::live;
+    for (int i = 0; i < 20000; ++i) {
+      round(i);
+    }
+    EXPECT_EQ(block_allocator::live, kept);
+    EXPECT_EQ(s21_keep.size(), 1U);
+  }
+  EXPECT_EQ(block_allocator::live, live);
+}
+
+TEST(UnrolledListTest, Spliced_lists_on_separate_threads) {
+  s21::UnrolledList<int> s21_a{1, 2, 3};
+  s21::UnrolledList<int> s21_b;
+  for (int i = 0; i < 500; ++i) {
+    s21_b.push_back(i);
+  }
+  s21_a.splice(s21_a.end(), s21_b);
+  for (int i = 0; i < 500; ++i) {
+    s21_b.push_back(i);
+  }
+
+  auto churn = [](s21::UnrolledList<int>* list) {
+    for (int i = 0; i < 20000; ++i) {
+      list->push_back(i);
+      list->pop_front();
+    }
+  };
+  std::thread t_a(churn, &s21_a);
+  std::thread t_b(churn, &s21_b);
+  t_a.join();
+  t_b.join();
+
+  EXPECT_EQ(s21_a.size(), 503U);
+  EXPECT_EQ(s21_b.size(), 500U);
+  EXPECT_EQ(s21_a.back(), 19999);
+}
+
+TEST(UnrolledListTest, Destroys_every_element) {
+  CountedValue::reset();
+  {
+    s21::UnrolledList<CountedValue, 64> s21_list;
+    for (int i = 0; i < 100; ++i) {
+      s21_list.push_back(CountedValue{});
+      s21_list.push_front(CountedValue{});
+    }
+    for (int i = 0; i < 30; ++i) {
+      s21_list.erase(std::next(s21_list.begin(), 50));
+      s21_list.insert(std::next(s21_list.begin(), 20), CountedValue{});
+    }
+    s21_list.pop_back();
+  }
+  EXPECT_EQ(CountedValue::constructed, CountedValue::destroyed);
+}
+
+// // // QUEUE
+
+template <typename value_type>
+bool compare_queues(s21::queue<value_type> my_queue,
+                    std::queue<value_type> std_queue) {
+  bool result = true;
+  if (my_queue.size() == std_queue.size()) {
+    while (!my_queue.empty() && !std_queue.empty()) {
+      if (my_queue.front() != std_queue.front()) {
+        result = false;
+        break;
+      }
+      my_queue.pop();
+      std_queue.pop();
+    }
+  } else {
+    result = false;
+  }
+  return result;
+}
+
+TEST(QueueTest, CompareQueues) {
+  s21::queue<int> my_queue{1, 3, 10, -5, 20};
+  std::queue<int> std_queue;
+  std_queue.push(1);
+  std_queue.push(3);
+  std_queue.push(10);
+  std_queue.push(-5);
+  std_queue.push(20);
+  EXPECT_TRUE(compare_queues(my_queue, std_queue));
+  std_queue.push(20);
+  EXPECT_FALSE(compare_queues(my_queue, std_queue));
+}
+
+TEST(QueueTest, CompareQueues_2) {
+  s21::queue<int> my_queue{1, 3, 10, -5, 20};
+  std::queue<int> std_queue;
+  std_queue.push(1);
+  std_queue.push(3);
+  std_queue.push(10);
+  std_queue.push(-5);
+  std_queue.push(100);
+  EXPECT_FALSE(compare_queues(my_queue, std_queue));
+}
+
+TEST(QueueTest, DefaultConstructor) {
+  s21::queue<int> my_queue;
+  std::queue<int> std_queue;
+  EXPECT_EQ(my_queue.size(), 0);
+  EXPECT_TRUE(my_queue.empty());
+  EXPECT_TRUE(compare_queues(my_queue, std_queue));
+}
+
+TEST(QueueTest, InitializerqueueConstructor) {
+  s21::queue<int> my_queue{1, 2, 3, 7, 9};
+  std::initializer_list<int> il = {1, 2, 3, 7, 9};
+  std::queue<int> std_queue{il};
+  EXPECT_TRUE(compare_queues(my_queue, std_queue));
+}
+
+TEST(QueueTest, InitializerqueueConstructor_2) {
+  std::initializer_list<int> b;
+  s21::queue<int> my_queue{b};
+  std::queue<int> std_queue{b};
+  EXPECT_TRUE(compare_queues(my_queue, std_queue));
+}
+
+TEST(QueueTest, CopyConstructor) {
+  s21::queue<int> my_queue{1, 2, 3, 7, 9};
   s21::queue<int> my_queue_copy(my_queue);
   std::initializer_list<int> il = {1, 2, 3, 7, 9};
   std::queue<int> std_queue{il};
@@ -1605,6 +3181,279 @@ TEST(QueueTest, Swap_2) {
   EXPECT_TRUE(compare_queues(my_queue2, std_queue2));
 }
 
+// // // MPMC QUEUE
+
+TEST(MpmcQueueTest, Bounded_fifo) {
+  s21::mpmc_queue<int> q(5);
+  EXPECT_EQ(q.capacity(), 8U);
+  EXPECT_TRUE(q.empty());
+
+  for (int i = 0; i < 8; ++i) {
+    EXPECT_TRUE(q.try_push(i));
+  }
+  EXPECT_FALSE(q.try_push(8));
+  EXPECT_EQ(q.size(), 8U);
+
+  int value = -1;
+  for (int i = 0; i < 8; ++i) {
+    EXPECT_TRUE(q.try_pop(value));
+    EXPECT_EQ(value, i);
+  }
+  EXPECT_FALSE(q.try_pop(value));
+  EXPECT_EQ(value, 7);
+
+  q.push(9);
+  q.pop(value);
+  EXPECT_EQ(value, 9);
+}
+
+TEST(MpmcQueueTest, Batch_operations) {
+  s21::mpmc_queue<int> q(8);
+  std::vector<int> in{1, 2, 3, 4, 5, 6};
+  EXPECT_EQ(q.try_push_many(in.begin(), in.size()), 6U);
+  EXPECT_EQ(q.try_push_many(in.begin(), in.size()), 2U);
+  EXPECT_EQ(q.try_push_many(in.begin(), 0), 0U);
+
+  int out[5] = {};
+  EXPECT_EQ(q.try_pop_many(out, 5), 5U);
+  EXPECT_EQ(out[0], 1);
+  EXPECT_EQ(out[4], 5);
+  EXPECT_EQ(q.pop_many(out, 5), 3U);
+  EXPECT_EQ(out[0], 6);
+  EXPECT_EQ(out[1], 1);
+  EXPECT_EQ(out[2], 2);
+  EXPECT_EQ(q.try_pop_many(out, 5), 0U);
+
+  q.push_many(in.begin(), 4);
+  EXPECT_EQ(q.size(), 4U);
+}
+
+TEST(MpmcQueueTest, Moves_and_destroys_elements) {
+  s21::mpmc_queue<std::unique_ptr<int>> q(4);
+  q.push(std::make_unique<int>(1));
+  EXPECT_TRUE(q.try_emplace(new int(2)));
+  std::unique_ptr<int> value;
+  q.pop(value);
+  EXPECT_EQ(*value, 1);
+
+  std::vector<std::unique_ptr<int>> batch;
+  batch.push_back(std::make_unique<int>(3));
+  batch.push_back(std::make_unique<int>(4));
+  EXPECT_EQ(q.try_push_many(std::make_move_iterator(batch.begin()), 2), 2U);
+  EXPECT_EQ(batch[0], nullptr);
+
+  CountedValue::reset();
+  {
+    s21::mpmc_queue<CountedValue> counted(4);
+    counted.push(CountedValue{});
+    counted.emplace();
+    CountedValue out;
+    counted.pop(out);
+  }
+  EXPECT_EQ(CountedValue::constructed, CountedValue::destroyed);
+}
+
+// Several producers and consumers through a small ring, mixing single and
+// batch operations. Run under ThreadSanitizer with `make tsan`.
+TEST(MpmcQueueTest, Stress_many_producers_many_consumers) {
+  constexpr int kThreads = 4;
+  constexpr int kPerProducer = 20000;
+  s21::mpmc_queue<int> q(64);
+  std::vector<std::atomic<int>> seen(kThreads * kPerProducer);
+  std::atomic<int> consumed{0};
+
+  std::vector<std::thread> threads;
+  for (int p = 0; p < kThreads; ++p) {
+    threads.emplace_back([&q, p] {
+      int base = p * kPerProducer;
+      for (int i = 0; i < kPerProducer;) {
+        if (i % 3) {
+          q.push(base + i++);
+        } else {
+          int batch[4];
+          int n = std::min(4, kPerProducer - i);
+          for (int k = 0; k < n; ++k) {
+            batch[k] = base + i + k;
+          }
+          q.push_many(batch, n);
+          i += n;
+        }
+      }
+    });
+  }
+  for (int c = 0; c < kThreads; ++c) {
+    threads.emplace_back([&q, &seen, &consumed, c] {
+      int out[8];
+      while (consumed.load() < kThreads * kPerProducer) {
+        size_t n = c % 2 ? q.try_pop_many(out, 8) : q.try_pop(out[0]);
+        for (size_t k = 0; k < n; ++k) {
+          seen[out[k]].fetch_add(1);
+        }
+        consumed.fetch_add(int(n));
+        if (!n) {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(consumed.load(), kThreads * kPerProducer);
+  EXPECT_TRUE(q.empty());
+  for (auto& count : seen) {
+    EXPECT_EQ(count.load(), 1);
+  }
+}
+
+// // // CONCURRENT MAP
+
+TEST(ConcurrentMapTest, Find_insert_erase) {
+  s21::ConcurrentMap<std::string, int> map;
+  EXPECT_EQ(map.shard_count(), 16U);
+  EXPECT_TRUE(map.empty());
+  EXPECT_FALSE(map.find("a").has_value());
+
+  EXPECT_TRUE(map.insert_or_assign("a", 1));
+  EXPECT_TRUE(map.insert_or_assign("b", 2));
+  EXPECT_FALSE(map.insert_or_assign("a", 3));
+  EXPECT_EQ(map.find("a").value(), 3);
+  EXPECT_TRUE(map.contains("b"));
+  EXPECT_EQ(map.size(), 2U);
+
+  EXPECT_EQ(map.erase("a"), 1U);
+  EXPECT_EQ(map.erase("a"), 0U);
+  EXPECT_FALSE(map.contains("a"));
+
+  int calls = 0;
+  auto make = [&calls](const std::string& key) {
+    ++calls;
+    return int(key.size());
+  };
+  EXPECT_EQ(map.compute_if_absent("ccc", make), 3);
+  EXPECT_EQ(map.compute_if_absent("ccc", make), 3);
+  EXPECT_EQ(map.compute_if_absent("b", make), 2);
+  EXPECT_EQ(calls, 1);
+
+  map.clear();
+  EXPECT_TRUE(map.empty());
+}
+
+TEST(ConcurrentMapTest, Keys_spread_over_shards) {
+  s21::ConcurrentMap<int, int, std::hash<int>, 1> single;
+  for (int i = 0; i < 1000; ++i) {
+    single.insert_or_assign(i * 16, i);
+  }
+  EXPECT_EQ(single.size(), 1000U);
+
+  s21::ConcurrentMap<int, int, std::hash<int>, 4> map;
+  std::vector<size_t> per_shard(map.shard_count());
+  for (int i = 0; i < 4000; ++i) {
+    map.insert_or_assign(i * 16, i);
+    ++per_shard[s21::PowerOfTwoBuckets::index(std::hash<int>()(i * 16),
+                                              map.shard_count())];
+  }
+  EXPECT_EQ(map.size(), 4000U);
+  for (size_t count : per_shard) {
+    EXPECT_GT(count, 800U);
+  }
+  for (int i = 0; i < 4000; ++i) {
+    ASSERT_EQ(map.find(i * 16).value(), i);
+  }
+}
+
+// Threads race to compute the same keys; each value is built exactly once.
+// Run under ThreadSanitizer with `make tsan`.
+TEST(ConcurrentMapTest, Compute_if_absent_races) {
+  constexpr int kThreads = 4;
+  constexpr int kKeys = 2000;
+  s21::ConcurrentMap<int, int, std::hash<int>, 8> map;
+  std::vector<std::atomic<int>> built(kKeys);
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&map, &built, t] {
+      for (int i = 0; i < kKeys; ++i) {
+        int key = (i + t * kKeys / kThreads) % kKeys;
+        int value = map.compute_if_absent(key, [&built](int k) {
+          built[k].fetch_add(1);
+          return k * 2;
+        });
+        EXPECT_EQ(value, key * 2);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(map.size(), size_t(kKeys));
+  for (auto& count : built) {
+    EXPECT_EQ(count.load(), 1);
+  }
+}
+
+// Writers own disjoint key ranges and keep a key's value at a multiple of
+// the key while readers scan every range
+TEST(ConcurrentMapTest, Stress_readers_and_writers) {
+  constexpr int kWriters = 3;
+  constexpr int kReaders = 3;
+  constexpr int kKeysPerWriter = 200;
+  constexpr int kRounds = 10;
+  s21::ConcurrentMap<int, int64_t, std::hash<int>, 4> map;
+  std::atomic<int> writers_left{kWriters};
+  std::atomic<bool> torn{false};
+
+  std::vector<std::thread> threads;
+  for (int w = 0; w < kWriters; ++w) {
+    threads.emplace_back([&map, &writers_left, w] {
+      int base = w * kKeysPerWriter + 1;
+      for (int round = 1; round <= kRounds; ++round) {
+        for (int i = 0; i < kKeysPerWriter; ++i) {
+          int key = base + i;
+          if ((i + round) % 5 == 0) {
+            map.erase(key);
+          } else {
+            map.insert_or_assign(key, int64_t(key) * round);
+          }
+        }
+      }
+      writers_left.fetch_sub(1);
+    });
+  }
+  for (int r = 0; r < kReaders; ++r) {
+    threads.emplace_back([&map, &writers_left, &torn] {
+      while (writers_left.load()) {
+        for (int key = 1; key <= kWriters * kKeysPerWriter; ++key) {
+          auto value = map.find(key);
+          if (value && (*value % key || *value / key > kRounds)) {
+            torn = true;
+          }
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_FALSE(torn.load());
+  size_t expected = 0;
+  for (int key = 1; key <= kWriters * kKeysPerWriter; ++key) {
+    int i = (key - 1) % kKeysPerWriter;
+    auto value = map.find(key);
+    if ((i + kRounds) % 5 == 0) {
+      EXPECT_FALSE(value.has_value());
+    } else {
+      ++expected;
+      ASSERT_TRUE(value.has_value());
+      EXPECT_EQ(*value, int64_t(key) * kRounds);
+    }
+  }
+  EXPECT_EQ(map.size(), expected);
+}
+
 // SET TEST
 
 TEST(setTest, DefaultConstructor) {
@@ -1796,6 +3645,47 @@ TEST(mapTest, Erase) {
   EXPECT_FALSE(map.contains(1));
 }
 
+// erase(iterator) has to find the entry's bucket from its hash, not from the
+// key itself, which can be past the last bucket or negative
+TEST(mapTest, Erase_iterator_with_keys_past_bucket_count) {
+  s21::Map<int, int> map;
+  const int keys[] = {1000, -7, 123456, 3, 1 << 20};
+  for (int key : keys) {
+    map.insert(key, key);
+  }
+  ASSERT_LT(map.bucket_count(), size_t(1000));
+
+  for (size_t i = 0; i < 3; ++i) {
+    map.erase(map.find(keys[i]));
+    EXPECT_FALSE(map.contains(keys[i]));
+  }
+  EXPECT_EQ(map.size(), 2);
+  EXPECT_EQ(map.at(3), 3);
+  EXPECT_EQ(map.at(1 << 20), 1 << 20);
+
+  s21::Set<std::string> set{"alpha", "beta", "gamma"};
+  set.erase(set.find("beta"));
+  EXPECT_EQ(set.size(), 2);
+  EXPECT_FALSE(set.contains("beta"));
+  EXPECT_TRUE(set.contains("gamma"));
+}
+
+TEST(mapTest, Iterates_every_element) {
+  s21::Map<int, int> map;
+  for (int i = 0; i < 25; ++i) {
+    map.insert(i * 3, i);
+  }
+
+  int visited = 0;
+  int sum = 0;
+  for (auto it = map.begin(); it != map.end(); ++it) {
+    ++visited;
+    sum += it->second;
+  }
+  EXPECT_EQ(visited, 25);
+  EXPECT_EQ(sum, 300);
+}
+
 TEST(mapTest, Swap) {
   s21::Map<int, std::string> map1;
   map1.insert({1, "one"});
@@ -1825,6 +3715,628 @@ TEST(mapTest, Contains) {
   EXPECT_FALSE(map.contains(3));
 }
 
+TEST(mapTest, Grows_within_max_load_factor) {
+  s21::Map<int, int> map;
+  for (int i = 0; i < 1000; ++i) {
+    map[i] = i * 2;
+    ASSERT_LE(map.load_factor(), map.max_load_factor());
+  }
+
+  EXPECT_EQ(map.size(), 1000);
+  EXPECT_GE(map.bucket_count(), 1000);
+  for (int i = 0; i < 1000; ++i) {
+    ASSERT_EQ(map.at(i), i * 2);
+  }
+}
+
+TEST(mapTest, Rehash_keeps_elements) {
+  s21::Map<std::string, int> map;
+  for (int i = 0; i < 100; ++i) {
+    map.insert(std::to_string(i), i);
+  }
+
+  map.rehash(1024);
+  EXPECT_EQ(map.bucket_count(), 1024);
+  map.rehash(0);
+  EXPECT_EQ(map.bucket_count(), 100);
+
+  EXPECT_EQ(map.size(), 100);
+  int sum = 0;
+  for (auto& el : map) {
+    EXPECT_EQ(std::to_string(el.second), el.first);
+    sum += el.second;
+  }
+  EXPECT_EQ(sum, 4950);
+}
+
+TEST(mapTest, Clear_after_rehash_keeps_bucket_count) {
+  CountedValue::reset();
+  {
+    s21::Map<int, CountedValue> map;
+    for (int i = 0; i < 1000; ++i) {
+      map.insert(i, CountedValue{});
+    }
+    size_t buckets = map.bucket_count();
+    int alive = CountedValue::constructed - CountedValue::destroyed;
+    EXPECT_EQ(alive, 1000);
+
+    map.clear();
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.bucket_count(), buckets);
+    EXPECT_EQ(CountedValue::constructed, CountedValue::destroyed);
+    EXPECT_TRUE(map.begin() == map.end());
+
+    for (int i = 0; i < 100; ++i) {
+      map.insert(i, CountedValue{});
+    }
+    EXPECT_EQ(map.size(), 100U);
+    EXPECT_EQ(map.bucket_count(), buckets);
+    size_t visited = 0;
+    for (auto it = map.begin(); it != map.end(); ++it) {
+      ++visited;
+    }
+    EXPECT_EQ(visited, 100U);
+  }
+  EXPECT_EQ(CountedValue::constructed, CountedValue::destroyed);
+}
+
+TEST(mapTest, Reserve_avoids_rehashing) {
+  s21::Map<int, int> map;
+  map.max_load_factor(0.5f);
+  map.reserve(500);
+  size_t buckets = map.bucket_count();
+  EXPECT_GE(buckets, 1000);
+
+  for (int i = 0; i < 500; ++i) {
+    map.insert(i, i);
+  }
+  EXPECT_EQ(map.bucket_count(), buckets);
+}
+
+// Walks from every iterator insert_many returned to end(), giving up after
+// more steps than there are elements
+template <typename Table, typename Results>
+void expect_insert_many_iterators_reach_end(Table& table,
+                                            const Results& results) {
+  for (const auto& result : results) {
+    size_t steps = 0;
+    for (auto it = result.first; it != table.end() && steps <= table.size();
+         ++it) {
+      ++steps;
+    }
+    EXPECT_LE(steps, table.size());
+  }
+}
+
+template <size_t... I>
+auto insert_many_pairs(s21::Map<int, int>& map, std::index_sequence<I...>) {
+  return map.insert_many(std::make_pair(int(I), int(I))...);
+}
+
+template <size_t... I>
+auto insert_many_keys(s21::Set<int>& set, std::index_sequence<I...>) {
+  return set.insert_many(int(I)...);
+}
+
+TEST(mapTest, Insert_many_iterators_survive_growth) {
+  s21::Map<int, int> map;
+  auto results = insert_many_pairs(map, std::make_index_sequence<60>());
+  EXPECT_EQ(map.size(), 60U);
+  EXPECT_EQ(results[0].first->first, 0);
+  EXPECT_EQ(results[59].first->first, 59);
+  expect_insert_many_iterators_reach_end(map, results);
+
+  s21::Set<int> set;
+  auto keys = insert_many_keys(set, std::make_index_sequence<60>());
+  EXPECT_EQ(set.size(), 60U);
+  EXPECT_TRUE(set.contains(59));
+  expect_insert_many_iterators_reach_end(set, keys);
+}
+
+TEST(mapTest, Max_load_factor) {
+  s21::Map<int, int> map;
+  for (int i = 0; i < 40; ++i) {
+    map.insert(i, i);
+  }
+
+  map.max_load_factor(0.25f);
+  EXPECT_LE(map.load_factor(), 0.25f);
+  EXPECT_EQ(map.size(), 40);
+  EXPECT_THROW(map.max_load_factor(0.0f), std::invalid_argument);
+  EXPECT_THROW(map.max_load_factor(-1.0f), std::invalid_argument);
+  EXPECT_EQ(map.max_load_factor(), 0.25f);
+}
+
+TEST(mapTest, Moved_from_is_usable) {
+  s21::Map<int, int> map{{1, 1}, {2, 2}};
+  s21::Map<int, int> other(std::move(map));
+
+  EXPECT_EQ(other.size(), 2);
+  EXPECT_TRUE(map.empty());
+  EXPECT_FALSE(map.contains(1));
+  EXPECT_EQ(map.find(1), map.end());
+  EXPECT_EQ(map.begin(), map.end());
+
+  map[3] = 3;
+  EXPECT_EQ(map.size(), 1);
+  EXPECT_EQ(map.at(3), 3);
+}
+
+TEST(mapTest, Begin_end_follow_erase_and_rehash) {
+  s21::Map<int, int> map;
+  map.reserve(1000);
+  for (int i = 100; i < 200; ++i) {
+    map.insert(i, i);
+  }
+  EXPECT_EQ(map.begin()->first, 100);
+
+  map.erase(map.find(100));
+  map.erase(map.find(199));
+  EXPECT_EQ(map.begin()->first, 101);
+  map.rehash(50);
+  int visited = 0;
+  for (auto it = map.begin(); it != map.end(); ++it) {
+    ++visited;
+  }
+  EXPECT_EQ(visited, 98);
+
+  while (!map.empty()) {
+    map.erase(map.begin());
+  }
+  EXPECT_EQ(map.begin(), map.end());
+  map[7] = 7;
+  EXPECT_EQ(map.begin()->first, 7);
+  EXPECT_EQ(++map.begin(), map.end());
+}
+
+TEST(mapTest, Const_table_iterates) {
+  s21::hash_table<int, int> table;
+  for (int i = 0; i < 30; ++i) {
+    table.insert(i, i);
+  }
+
+  const auto& view = table;
+  int sum = 0;
+  for (auto it = view.cbegin(); it != view.cend(); ++it) {
+    sum += it->second;
+  }
+  EXPECT_EQ(sum, 435);
+  EXPECT_NE(view.begin(), view.end());
+}
+
+struct CountingHash {
+  static inline size_t calls = 0;
+
+  size_t operator()(int key) const {
+    ++calls;
+    return std::hash<int>()(key);
+  }
+};
+
+TEST(mapTest, Rehash_reuses_cached_hashes) {
+  s21::Map<int, int, CountingHash> map;
+  CountingHash::calls = 0;
+  for (int i = 0; i < 1000; ++i) {
+    map.insert(i, i);
+  }
+  EXPECT_EQ(CountingHash::calls, 1000);
+
+  map.rehash(4096);
+  EXPECT_EQ(CountingHash::calls, 1000);
+  EXPECT_EQ(map.at(5), 5);
+  EXPECT_EQ(CountingHash::calls, 1001);
+}
+
+struct ComparedKey {
+  static inline size_t compares = 0;
+
+  friend bool operator==(const ComparedKey& a, const ComparedKey& b) {
+    ++compares;
+    return a.value == b.value;
+  }
+
+  int value;
+};
+
+struct ComparedKeyHash {
+  size_t operator()(const ComparedKey& key) const { return key.value; }
+};
+
+TEST(mapTest, Lookups_compare_only_matching_hashes) {
+  s21::Map<ComparedKey, int, ComparedKeyHash> map;
+  map.max_load_factor(100.0f);
+  for (int i = 0; i < 50; ++i) {
+    map.insert({ComparedKey{i}, i});
+  }
+  map.rehash(1);
+  ASSERT_EQ(map.bucket_count(), 1);
+
+  ComparedKey::compares = 0;
+  EXPECT_EQ(map.at(ComparedKey{42}), 42);
+  EXPECT_EQ(ComparedKey::compares, 1);
+  EXPECT_FALSE(map.contains(ComparedKey{50}));
+  EXPECT_EQ(ComparedKey::compares, 1);
+}
+
+// Key that counts how often it is built, looked up by std::string_view
+struct Name {
+  static inline size_t built = 0;
+
+  explicit Name(std::string_view name) : text(name) { ++built; }
+
+  friend bool operator==(const Name& a, const Name& b) {
+    return a.text == b.text;
+  }
+  friend bool operator==(const Name& a, std::string_view b) {
+    return a.text == b;
+  }
+
+  std::string text;
+};
+
+struct NameHash {
+  using is_transparent = void;
+
+  size_t operator()(std::string_view name) const {
+    return std::hash<std::string_view>()(name);
+  }
+  size_t operator()(const Name& name) const { return (*this)(name.text); }
+};
+
+struct StringHash {
+  using is_transparent = void;
+
+  size_t operator()(std::string_view str) const {
+    return std::hash<std::string_view>()(str);
+  }
+};
+
+TEST(mapTest, Transparent_lookup_builds_no_keys) {
+  s21::Map<Name, int, NameHash> map;
+  for (int i = 0; i < 20; ++i) {
+    map.insert({Name("name" + std::to_string(i)), i});
+  }
+
+  Name::built = 0;
+  std::string_view query = "name7";
+  EXPECT_EQ(map.find(query)->second, 7);
+  EXPECT_EQ(map.at(query), 7);
+  EXPECT_TRUE(map.contains(query));
+  EXPECT_FALSE(map.contains(std::string_view("name20")));
+  EXPECT_THROW(map.at(std::string_view("name20")), std::out_of_range);
+  EXPECT_EQ(map.erase(query), 1);
+  EXPECT_EQ(map.erase(query), 0);
+  EXPECT_EQ(Name::built, 0);
+  EXPECT_EQ(map.size(), 19);
+}
+
+TEST(mapTest, Transparent_lookup_with_string_keys) {
+  s21::Map<std::string, int, StringHash> map{{"alpha", 1}, {"beta", 2}};
+  char buffer[] = "beta,gamma";
+  std::string_view request(buffer, 4);
+
+  EXPECT_EQ(map.at(request), 2);
+  EXPECT_EQ(map.find("alpha")->second, 1);
+  EXPECT_FALSE(map.contains("gamma"));
+  EXPECT_EQ(map.erase("alpha"), 1);
+  EXPECT_EQ(map.size(), 1);
+
+  s21::Map<std::string, int> plain{{"alpha", 1}};
+  EXPECT_EQ(plain.find("alpha")->second, 1);
+  EXPECT_EQ(plain.erase("alpha"), 1);
+  EXPECT_TRUE(plain.empty());
+}
+
+TEST(setTest, Transparent_lookup) {
+  s21::Set<std::string, StringHash> set{"x", "y"};
+  EXPECT_TRUE(set.contains(std::string_view("x")));
+  EXPECT_NE(set.find("y"), set.end());
+  EXPECT_EQ(set.erase(std::string_view("x")), 1);
+  EXPECT_FALSE(set.contains("x"));
+}
+
+// Case-insensitive ASCII keys, to exercise a custom KeyEqual
+struct CaseInsensitiveHash {
+  size_t operator()(const std::string& str) const {
+    std::string lower(str);
+    for (char& c : lower) {
+      c = char(std::tolower(static_cast<unsigned char>(c)));
+    }
+    return std::hash<std::string>()(lower);
+  }
+};
+
+struct CaseInsensitiveEqual {
+  bool operator()(const std::string& a, const std::string& b) const {
+    return std::equal(a.begin(), a.end(), b.begin(), b.end(),
+                      [](unsigned char x, unsigned char y) {
+                        return std::tolower(x) == std::tolower(y);
+                      });
+  }
+};
+
+TEST(mapTest, Custom_key_equal) {
+  s21::Map<std::string, int, CaseInsensitiveHash,
+           s21::hash_table<std::string, int, CaseInsensitiveHash,
+                           CaseInsensitiveEqual>>
+      map;
+  EXPECT_TRUE(map.insert("Alpha", 1).second);
+  EXPECT_FALSE(map.insert("ALPHA", 2).second);
+  EXPECT_EQ(map.size(), 1);
+  EXPECT_EQ(map.at("alpha"), 1);
+  map["aLpHa"] = 3;
+  EXPECT_EQ(map.find("ALPHA")->second, 3);
+  EXPECT_EQ(map.find("ALPHA")->first, "Alpha");
+  EXPECT_EQ(map.erase("alpha"), 1);
+  EXPECT_TRUE(map.empty());
+
+  s21::Set<std::string, CaseInsensitiveHash,
+           s21::flat_hash_table<std::string, std::string, CaseInsensitiveHash,
+                                CaseInsensitiveEqual>>
+      set{"Beta", "BETA", "gamma"};
+  EXPECT_EQ(set.size(), 2);
+  EXPECT_TRUE(set.contains("beta"));
+  EXPECT_TRUE(set.contains("GAMMA"));
+}
+
+TEST(mapTest, Table_supplies_hasher_and_key_equal) {
+  using Flat = s21::flat_hash_table<int, int, std::hash<int>>;
+  static_assert(std::is_same_v<s21::Map<int, int, std::hash<int>, Flat>::table,
+                               Flat>);
+  static_assert(
+      std::is_same_v<s21::Set<int, std::hash<int>, Flat>::table, Flat>);
+  static_assert(std::is_same_v<s21::Map<int, int>::key_equal,
+                               std::equal_to<int>>);
+  static_assert(
+      std::is_same_v<s21::Map<std::string, int, StringHash>::key_equal,
+                     std::equal_to<>>);
+  static_assert(std::is_same_v<
+                s21::Map<std::string, int, CaseInsensitiveHash,
+                         s21::hash_table<std::string, int, CaseInsensitiveHash,
+                                         CaseInsensitiveEqual>>::key_equal,
+                CaseInsensitiveEqual>);
+
+  s21::Map<int, int, std::hash<int>, Flat> map{{1, 10}};
+  EXPECT_EQ(map.at(1), 10);
+}
+
+template <typename K, typename V>
+using PowerOfTwoTable = s21::hash_table<K, V, std::hash<K>, std::equal_to<K>,
+                                        s21::PowerOfTwoBuckets>;
+
+TEST(mapTest, Power_of_two_buckets) {
+  EXPECT_EQ(s21::PowerOfTwoBuckets::count(0), 1);
+  EXPECT_EQ(s21::PowerOfTwoBuckets::count(1), 1);
+  EXPECT_EQ(s21::PowerOfTwoBuckets::count(10), 16);
+  EXPECT_EQ(s21::PowerOfTwoBuckets::count(16), 16);
+
+  s21::Map<int, int, std::hash<int>, PowerOfTwoTable<int, int>> map;
+  EXPECT_EQ(map.bucket_count(), 16);
+  const int n = 5000;
+  for (int i = 0; i < n; ++i) {
+    map.insert(i * 1024, i);
+  }
+  size_t buckets = map.bucket_count();
+  EXPECT_EQ(buckets & (buckets - 1), 0);
+  EXPECT_LE(map.load_factor(), map.max_load_factor());
+  for (int i = 0; i < n; ++i) {
+    ASSERT_EQ(map.at(i * 1024), i);
+  }
+  EXPECT_FALSE(map.contains(1));
+
+  map.rehash(3000);
+  EXPECT_EQ(map.bucket_count(), 8192);
+  map.reserve(10000);
+  EXPECT_EQ(map.bucket_count(), 16384);
+  size_t seen = 0;
+  for (auto& item : map) {
+    EXPECT_EQ(item.first, item.second * 1024);
+    ++seen;
+  }
+  EXPECT_EQ(seen, n);
+  for (int i = 0; i < n; i += 2) {
+    EXPECT_EQ(map.erase(i * 1024), 1);
+  }
+  EXPECT_EQ(map.size(), n / 2);
+  EXPECT_TRUE(map.contains(1024));
+  EXPECT_FALSE(map.contains(2048));
+}
+
+TEST(mapTest, Power_of_two_buckets_spread_strided_keys) {
+  PowerOfTwoTable<int, int> table;
+  table.rehash(1024);
+  for (int i = 0; i < 1024; ++i) {
+    table.insert(i << 10, i);
+  }
+  ASSERT_EQ(table.bucket_count(), 1024);
+
+  std::vector<size_t> per_bucket(table.bucket_count());
+  for (auto& item : table) {
+    ++per_bucket[s21::PowerOfTwoBuckets::index(std::hash<int>()(item.first),
+                                               table.bucket_count())];
+  }
+  EXPECT_LE(*std::max_element(per_bucket.begin(), per_bucket.end()), 8);
+}
+
+// Map and Set over the open-addressing backend
+
+template <typename K, typename V>
+using FlatMap = s21::Map<K, V, std::hash<K>, s21::flat_hash_table<K, V>>;
+
+TEST(flatMapTest, Insert_find_and_at) {
+  FlatMap<std::string, int> map{{"one", 1}, {"two", 2}};
+  EXPECT_TRUE(map.insert("three", 3).second);
+  EXPECT_FALSE(map.insert("one", 10).second);
+  map.insert_or_assign("two", 20);
+
+  EXPECT_EQ(map.size(), 3);
+  EXPECT_EQ(map.at("one"), 1);
+  EXPECT_EQ(map.at("two"), 20);
+  EXPECT_EQ(map.find("three")->second, 3);
+  EXPECT_EQ(map.find("four"), map.end());
+  EXPECT_FALSE(map.contains("four"));
+  EXPECT_THROW(map.at("four"), std::out_of_range);
+}
+
+TEST(flatMapTest, Matches_unordered_map_under_churn) {
+  FlatMap<int, int> map;
+  std::unordered_map<int, int> expected;
+  std::mt19937 gen(3);
+  std::uniform_int_distribution<int> key(0, 300);
+
+  for (int i = 0; i < 20000; ++i) {
+    int k = key(gen);
+    if (gen() % 3) {
+      map[k] = i;
+      expected[k] = i;
+    } else if (expected.erase(k)) {
+      map.erase(map.find(k));
+    }
+    ASSERT_EQ(map.size(), expected.size());
+  }
+
+  for (int k = 0; k <= 300; ++k) {
+    auto it = expected.find(k);
+    if (it == expected.end()) {
+      EXPECT_FALSE(map.contains(k));
+    } else {
+      EXPECT_EQ(map.at(k), it->second);
+    }
+  }
+  size_t visited = 0;
+  for (auto& el : map) {
+    EXPECT_EQ(expected.at(el.first), el.second);
+    ++visited;
+  }
+  EXPECT_EQ(visited, expected.size());
+}
+
+TEST(flatMapTest, Erase_everything_leaves_no_tombstones) {
+  FlatMap<int, int> map;
+  map.reserve(1000);
+  size_t buckets = map.bucket_count();
+  for (int round = 0; round < 5; ++round) {
+    for (int i = 0; i < 800; ++i) {
+      map.insert(round * 1000 + i, i);
+    }
+    while (!map.empty()) {
+      map.erase(map.begin());
+    }
+  }
+
+  EXPECT_EQ(map.bucket_count(), buckets);
+  EXPECT_EQ(map.begin(), map.end());
+  EXPECT_FALSE(map.contains(4000));
+}
+
+// Throws from the call that brings calls_left to zero
+struct ThrowingHash {
+  static inline int calls_left = -1;
+
+  size_t operator()(int key) const {
+    if (--calls_left == 0) {
+      throw std::runtime_error("hash");
+    }
+    return std::hash<int>()(key);
+  }
+};
+
+TEST(flatMapTest, Erase_survives_a_throwing_hasher) {
+  s21::flat_hash_table<int, std::string, ThrowingHash> table;
+  for (int i = 0; i < 200; ++i) {
+    table.insert(i, std::string(32, char('a' + i % 26)));
+  }
+
+  int throws = 0;
+  for (int i = 0; i < 200; ++i) {
+    // The first call hashes the key being erased; the second one is the
+    // first entry the backward shift looks at, if there is one
+    ThrowingHash::calls_left = 2;
+    try {
+      table.erase(i);
+    } catch (const std::runtime_error&) {
+      ++throws;
+    }
+    ThrowingHash::calls_left = -1;
+
+    size_t visited = 0;
+    for (auto it = table.begin(); it != table.end(); ++it) {
+      ++visited;
+    }
+    EXPECT_EQ(visited, table.size());
+  }
+  EXPECT_GT(throws, 0);
+  EXPECT_EQ(table.size(), 0U);
+}
+
+TEST(flatMapTest, Rehash_and_load_factor) {
+  FlatMap<int, int> map;
+  for (int i = 0; i < 1000; ++i) {
+    map.insert(i, i);
+    ASSERT_LE(map.load_factor(), map.max_load_factor());
+  }
+
+  map.rehash(8192);
+  EXPECT_EQ(map.bucket_count(), 8192);
+  map.max_load_factor(0.5f);
+  EXPECT_LE(map.load_factor(), 0.5f);
+  EXPECT_THROW(map.max_load_factor(1.0f), std::invalid_argument);
+  EXPECT_THROW(map.max_load_factor(0.0f), std::invalid_argument);
+  for (int i = 0; i < 1000; ++i) {
+    ASSERT_EQ(map.at(i), i);
+  }
+}
+
+TEST(flatMapTest, Copy_move_and_swap) {
+  FlatMap<std::string, std::string> map{{"a", "1"}, {"b", "2"}};
+  FlatMap<std::string, std::string> copy(map);
+  copy["c"] = "3";
+  EXPECT_EQ(map.size(), 2);
+  EXPECT_EQ(copy.size(), 3);
+
+  FlatMap<std::string, std::string> moved(std::move(copy));
+  EXPECT_EQ(moved.at("c"), "3");
+  EXPECT_TRUE(copy.empty());
+  EXPECT_EQ(copy.begin(), copy.end());
+  copy["d"] = "4";
+  EXPECT_EQ(copy.at("d"), "4");
+
+  map.swap(moved);
+  EXPECT_EQ(map.size(), 3);
+  EXPECT_EQ(moved.size(), 2);
+  moved = map;
+  EXPECT_EQ(moved.at("c"), "3");
+}
+
+TEST(flatMapTest, Transparent_lookup) {
+  s21::Map<std::string, int, StringHash,
+           s21::flat_hash_table<std::string, int, StringHash>>
+      map{{"alpha", 1}, {"beta", 2}};
+  std::string_view query = "beta";
+
+  EXPECT_EQ(map.at(query), 2);
+  EXPECT_EQ(map.find("alpha")->second, 1);
+  EXPECT_TRUE(map.contains(query));
+  EXPECT_EQ(map.erase(query), 1);
+  EXPECT_EQ(map.erase("gamma"), 0);
+  EXPECT_FALSE(map.contains("beta"));
+}
+
+TEST(flatSetTest, Insert_erase_contains) {
+  s21::Set<int, std::hash<int>, s21::flat_hash_table<int, int>> set{1, 2, 3};
+  EXPECT_FALSE(set.insert(2).second);
+  auto results = set.insert_many(4, 5, 6);
+  for (auto& result : results) {
+    EXPECT_TRUE(result.second);
+    EXPECT_TRUE(set.contains(result.first->first));
+  }
+
+  set.erase(set.find(3));
+  EXPECT_EQ(set.size(), 5);
+  EXPECT_FALSE(set.contains(3));
+  EXPECT_TRUE(set.contains(6));
+}
+
 TEST(InsertManyTest, InsertSinglManyElement) {
   s21::Multiset<double> ms;
   double num = 3.14;
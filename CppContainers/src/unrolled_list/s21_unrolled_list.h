@@ -0,0 +1,574 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_list_pool.h"
+#include "s21_unrolled_list_block.h"
+#include "s21_unrolled_list_iterator.h"
+
+namespace s21 {
+
+// Doubly linked list of blocks, each holding up to block_capacity()
+// elements in place, so sequential access walks contiguous slots and the
+// per-element overhead is a fraction of a List node. Blocks come from the
+// same slab pool as List nodes and are recycled as a FIFO drains.
+//
+// Every block keeps at least one element. Insertion and erasure in the
+// middle shift elements within one block (splitting it when full), so
+// unlike List they invalidate iterators into that block.
+template <typename T, size_t BlockBytes = 512,
+          typename Allocator = std::allocator<T>>
+class UnrolledList {
+  static constexpr size_t kHeaderBytes = sizeof(UnrolledListBlockBase);
+  static constexpr size_t kBlockCapacity =
+      BlockBytes >= kHeaderBytes + 2 * sizeof(T)
+          ? (BlockBytes - kHeaderBytes) / sizeof(T)
+          : 2;
+  static_assert(kBlockCapacity <= UINT32_MAX,
+                "UnrolledList block windows are 32-bit");
+
+  using block_base = UnrolledListBlockBase;
+  using block = UnrolledListBlock<T, kBlockCapacity>;
+  using pool = ListNodePool<block, Allocator>;
+
+ public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = size_t;
+  using iterator = UnrolledListIterator<block>;
+  using const_iterator = ConstUnrolledListIterator<block>;
+
+  UnrolledList() = default;
+  explicit UnrolledList(const Allocator& alloc);
+  UnrolledList(std::initializer_list<value_type> const& items,
+               const Allocator& alloc = Allocator());
+  UnrolledList(const UnrolledList& other);
+  UnrolledList(UnrolledList&& other) noexcept;
+  ~UnrolledList() noexcept;
+
+  UnrolledList& operator=(const UnrolledList& other);
+  UnrolledList& operator=(UnrolledList&& other) noexcept;
+
+  allocator_type get_allocator() const { return pool_.get_allocator(); }
+  static constexpr size_type block_capacity() noexcept {
+    return kBlockCapacity;
+  }
+
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+  const_iterator cbegin() const;
+  const_iterator cend() const;
+
+  reference front();
+  const_reference front() const;
+  reference back();
+  const_reference back() const;
+
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+  size_type max_size() const noexcept;
+
+  void clear() noexcept;
+
+  iterator insert(const_iterator pos, const_reference value);
+  template <typename... Args>
+  iterator insert_many(const_iterator pos, Args&&... args);
+  template <typename... Args>
+  void insert_many_back(Args&&... args);
+  template <typename... Args>
+  void insert_many_front(Args&&... args);
+
+  // Returns the element that followed pos
+  iterator erase(const_iterator pos);
+  void push_back(const_reference value);
+  void pop_back();
+  void push_front(const_reference value);
+  void pop_front();
+  void swap(UnrolledList& other) noexcept;
+  // Moves other's blocks in front of pos without touching their elements.
+  // If pos is inside a block, that block is split at pos first.
+  void splice(const_iterator pos, UnrolledList& other);
+
+ private:
+  static block* as_block(ListNodeBase* ptr) noexcept {
+    return static_cast<block*>(ptr);
+  }
+  static const block_base* header(ListNodeBase* ptr) noexcept {
+    return static_cast<const block_base*>(ptr);
+  }
+
+  // An empty block with its window at start, linked in front of pos
+  block* create_block(ListNodeBase* pos, size_t start);
+  void destroy_block(block* ptr) noexcept;
+  // Moves the elements from index at onward into a new block after ptr
+  block* split(block* ptr, size_t at);
+  // Points the sentinel at [first, last], or at itself when size_ is 0
+  void attach(ListNodeBase* first, ListNodeBase* last) noexcept;
+
+  block_base sentinel_;
+  size_type size_{};
+  pool pool_;
+};
+
+template <typename T, size_t BlockBytes, typename Allocator>
+UnrolledList<T, BlockBytes, Allocator>::UnrolledList(const Allocator& alloc)
+    : pool_(alloc) {}
+
+template <typename T, size_t BlockBytes, typename Allocator>
+UnrolledList<T, BlockBytes, Allocator>::UnrolledList(
+    std::initializer_list<value_type> const& items, const Allocator& alloc)
+    : pool_(alloc) {
+  for (auto& el : items) {
+    push_back(el);
+  }
+}
+
+template <typename T, size_t BlockBytes, typename Allocator>
+UnrolledList<T, BlockBytes, Allocator>::UnrolledList(const UnrolledList& other)
+    : pool_(std::allocator_traits<Allocator>::
+                select_on_container_copy_construction(other.get_allocator())) {
+  for (auto& el : other) {
+    push_back(el);
+  }
+}
+
+template <typename T, size_t BlockBytes, typename Allocator>
+UnrolledList<T, BlockBytes, Allocator>::UnrolledList(
+    UnrolledList&& other) noexcept
+    : size_(other.size_), pool_(std::move(other.pool_)) {
+  attach(other.sentinel_.next(), other.sentinel_.prev());
+  other.size_ = 0;
+  other.attach(nullptr, nullptr);
+}
+
+template <typename T, size_t BlockBytes, typename Allocator>
+UnrolledList<T, BlockBytes, Allocator>::~UnrolledList() noexcept {
+  clear();
+}
+
+template <typename T, size_t BlockBytes, typename Allocator>
+UnrolledList<T, BlockBytes, Allocator>&
+UnrolledList<T, BlockBytes, Allocator>::operator=(const UnrolledList& other) {
+  if (this != &other) {
+    UnrolledList tmp(other);
+    swap(tmp);
+  }
+
+  return *this;
+}
+
+template <typename T, size_t BlockBytes, typename Allocator>
+UnrolledList<T, BlockBytes, Allocator>&
+UnrolledList<T, BlockBytes, Allocator>::operator=(
+    UnrolledList&& other) noexcept {
+  swap(other);
+
+  return *this;
+}
+
+template <typename T, size_t BlockBytes, typename Allocator>
+typename UnrolledList<T, BlockBytes, Allocator>::iterator
+UnrolledList<T, BlockBytes, Allocator>::begin() {
+  ListNodeBase* first = sentinel_.next();
+  return iterator(first, header(first)->begin_index());
+}
+
+template <typename T, size_t BlockBytes, typename Allocator>
+typename UnrolledList<T, BlockBytes, Allocator>::iterator
+UnrolledList<T, BlockBytes, Allocator>::end() {
+  return iterator(&sentinel_, 0);
+}
+
+template <typename T, size_t BlockBytes, typename Allocator>
+typename UnrolledList<T, BlockBytes, Allocator>::const_iterator
+UnrolledList<T, BlockBytes, Allocator>::begin() const {
+  ListNodeBase* first = sentinel_.next();
+  return const_iterator(first, header(first)->begin_index());
+}
+
+template <typename T, size_t BlockBytes, typename Allocator>
+typename UnrolledList<T, BlockBytes, Allocator>::const_iterator
+UnrolledList<T, BlockBytes, Allocator>::end() const {
+  return const_iterator(const_cast<block_base*>(&sentinel_), 0);
+}
+
+template <typename T, size_t BlockBytes, typename Allocator>
+typename UnrolledList<T, BlockBytes, Allocator>::const_iterator
+UnrolledList<T, BlockBytes, Allocator>::cbegin() const {
+  return begin();
+}
+
+template <typename T, size_t BlockBytes, typename Allocator>
+typename UnrolledList<T, BlockBytes, Allocator>::const_iterator
+UnrolledList<T, BlockBytes, Allocator>::cend() const {
+  return end();
+}
+
+template <typename T, size_t BlockBytes, typename Allocator>
+typename UnrolledList<T, BlockBytes, Allocator>::reference
+UnrolledList<T, BlockBytes, Allocator>::front() {
+  return *begin();
+}
+
+template <typename T, size_t BlockBytes, typename Allocator>
+typename UnrolledList<T, BlockBytes, Allocator>::const_reference
+UnrolledList<T, BlockBytes, Allocator>::front() const {
+  return *begin();
+}
+
+template <typename T, size_t BlockBytes, typename Allocator>
+typename UnrolledList<T, BlockBytes, Allocator>::reference
+UnrolledList<T, BlockBytes, Allocator>::back() {
+  block* last = as_block(sentinel_.prev());
+  return last->at(last->end_index() - 1);
+}
+
+template <typename T, size_t BlockBytes, typename Allocator>
+typename UnrolledList<T, BlockBytes, Allocator>::const_reference
+UnrolledList<T, BlockBytes, Allocator>::back() const {
+  block* last = as_block(sentinel_.prev());
+  return last->at(last->end_index() - 1);
+}
+
+template <typename T, size_t BlockBytes, typename Allocator>
+bool UnrolledList<T, BlockBytes, Allocator>::empty() const noexcept {
+  return !size();
+}
+
+template <typename T, size_t BlockBytes, typename Allocator>
+typename UnrolledList<T, BlockBytes, Allocator>::size_type
+UnrolledList<T, BlockBytes, Allocator>::size() const noexcept {
+  return size_;
+}
+
+template <typename T, size_t BlockBytes, typename Allocator>
+typename UnrolledList<T, BlockBytes, Allocator>::size_type
+UnrolledList<T, BlockBytes, Allocator>::max_size() const noexcept {
+  return std::numeric_limits<size_type>::max();
+}
+
+template <typename T, size_t BlockBytes, typename Allocator>
+void UnrolledList<T, BlockBytes, Allocator>::clear() noexcept {
+  // Elements are destroyed block by block. If every block carved from the
+  // pool's slabs is in this list and nothing else is, the slabs go back
+  // whole. Once blocks have been spliced in from or out to another list,
+  // each block is returned on its own so it reaches the pool that carved
+  // it, and this list keeps its slabs for later pushes.
+  bool exclusive = pool_.exclusive();
+  if (!exclusive || !std::is_trivially_destructible_v<T>) {
+    for (ListNodeBase* ptr = sentinel_.next(); ptr != &sentinel_;) {
+      ListNodeBase* next = ptr->next();
+      block* current = as_block(ptr);
+      std::destroy(current->slot(current->begin_index()),
+                   current->slot(current->end_index()));
+      if (!exclusive) {
+        current->~block();
+        pool_.deallocate(current);
+      }
+      ptr = next;
+    }
+  }
+  if (exclusive) {
+    pool_.release();
+  }
+
+  size_ = 0;
+  attach(nullptr, nullptr);
+}
+
+template <typename T, size_t BlockBytes, typename Allocator>
+typename UnrolledList<T, BlockBytes, Allocator>::block*
+UnrolledList<T, BlockBytes, Allocator>::create_block(ListNodeBase* pos,
+                                                     size_t start) {
+  block* ptr = ::new (static_cast<void*>(pool_.allocate())) block(start);
+  ptr->hook(pos);
+
+  return ptr;
+}
+
+template <typename T, size_t BlockBytes, typename Allocator>
+void UnrolledList<T, BlockBytes, Allocator>::destroy_block(
+    block* ptr) noexcept {
+  ptr->unhook();
+  ptr->~block();
+  pool_.deallocate(ptr);
+}
+
+template <typename T, size_t BlockBytes, typename Allocator>
+typename UnrolledList<T, BlockBytes, Allocator>::block*
+UnrolledList<T, BlockBytes, Allocator>::split(block* ptr, size_t at) {
+  block* tail = create_block(ptr->next(), 0);
+  try {
+    std::uninitialized_move(ptr->slot(at), ptr->slot(ptr->end_index()),
+                            tail->slot(0));
+  } catch (...) {
+    destroy_block(tail);
+    throw;
+  }
+
+  std::destroy(ptr->slot(at), ptr->slot(ptr->end_index()));
+  tail->set_end(ptr->end_index() - at);
+  ptr->set_end(at);
+
+  return tail;
+}
+
+template <typename T, size_t BlockBytes, typename Allocator>
+void UnrolledList<T, BlockBytes, Allocator>::attach(
+    ListNodeBase* first, ListNodeBase* last) noexcept {
+  if (!size_) {
+    sentinel_.set_next(&sentinel_);
+    sentinel_.set_prev(&sentinel_);
+    return;
+  }
+
+  sentinel_.set_next(first);
+  sentinel_.set_prev(last);
+  first->set_prev(&sentinel_);
+  last->set_next(&sentinel_);
+}
+
+template <typename T, size_t BlockBytes, typename Allocator>
+void UnrolledList<T, BlockBytes, Allocator>::push_back(
+    const_reference value) {
+  ListNodeBase* last = sentinel_.prev();
+  if (last != &sentinel_ && header(last)->end_index() < kBlockCapacity) {
+    block* ptr = as_block(last);
+    ::new (static_cast<void*>(ptr->slot(ptr->end_index()))) T(value);
+    ptr->set_end(ptr->end_index() + 1);
+  } else {
+    block* ptr = create_block(&sentinel_, 0);
+    try {
+      ::new (static_cast<void*>(ptr->slot(0))) T(value);
+    } catch (...) {
+      destroy_block(ptr);
+      throw;
+    }
+    ptr->set_end(1);
+  }
+  ++size_;
+}
+
+template <typename T, size_t BlockBytes, typename Allocator>
+void UnrolledList<T, BlockBytes, Allocator>::push_front(
+    const_reference value) {
+  ListNodeBase* first = sentinel_.next();
+  if (first != &sentinel_ && header(first)->begin_index() > 0) {
+    block* ptr = as_block(first);
+    ::new (static_cast<void*>(ptr->slot(ptr->begin_index() - 1))) T(value);
+    ptr->set_begin(ptr->begin_index() - 1);
+  } else {
+    block* ptr = create_block(first, kBlockCapacity);
+    try {
+      ::new (static_cast<void*>(ptr->slot(kBlockCapacity - 1))) T(value);
+    } catch (...) {
+      destroy_block(ptr);
+      throw;
+    }
+    ptr->set_begin(kBlockCapacity - 1);
+  }
+  ++size_;
+}
+
+template <typename T, size_t BlockBytes, typename Allocator>
+void UnrolledList<T, BlockBytes, Allocator>::pop_back() {
+  if (empty()) {
+    throw std::runtime_error("Error: UnrolledList is empty");
+  }
+
+  block* last = as_block(sentinel_.prev());
+  std::destroy_at(last->slot(last->end_index() - 1));
+  last->set_end(last->end_index() - 1);
+  if (last->empty()) {
+    destroy_block(last);
+  }
+  --size_;
+}
+
+template <typename T, size_t BlockBytes, typename Allocator>
+void UnrolledList<T, BlockBytes, Allocator>::pop_front() {
+  if (empty()) {
+    throw std::runtime_error("Error: UnrolledList is empty");
+  }
+
+  block* first = as_block(sentinel_.next());
+  std::destroy_at(first->slot(first->begin_index()));
+  first->set_begin(first->begin_index() + 1);
+  if (first->empty()) {
+    destroy_block(first);
+  }
+  --size_;
+}
+
+// Makes room at pos by shifting whichever side of the block has a free slot
+// next to it, after splitting the block if it is full
+template <typename T, size_t BlockBytes, typename Allocator>
+typename UnrolledList<T, BlockBytes, Allocator>::iterator
+UnrolledList<T, BlockBytes, Allocator>::insert(const_iterator pos,
+                                               const_reference value) {
+  if (pos.get_node() == &sentinel_) {
+    push_back(value);
+    ListNodeBase* last = sentinel_.prev();
+    return iterator(last, header(last)->end_index() - 1);
+  }
+
+  block* ptr = as_block(pos.get_node());
+  size_t index = pos.get_index();
+  if (index == ptr->begin_index() && index > 0) {
+    ::new (static_cast<void*>(ptr->slot(index - 1))) T(value);
+    ptr->set_begin(index - 1);
+    ++size_;
+    return iterator(ptr, index - 1);
+  }
+
+  T tmp(value);
+  if (ptr->full()) {
+    size_t middle = kBlockCapacity / 2;
+    block* tail = split(ptr, middle);
+    if (index >= middle) {
+      ptr = tail;
+      index -= middle;
+    }
+  }
+
+  size_t first = ptr->begin_index();
+  size_t last = ptr->end_index();
+  if (last < kBlockCapacity) {
+    ::new (static_cast<void*>(ptr->slot(last)))
+        T(std::move(ptr->at(last - 1)));
+    std::move_backward(ptr->slot(index), ptr->slot(last - 1),
+                       ptr->slot(last));
+    ptr->set_end(last + 1);
+    ptr->at(index) = std::move(tmp);
+  } else {
+    ::new (static_cast<void*>(ptr->slot(first - 1)))
+        T(std::move(ptr->at(first)));
+    std::move(ptr->slot(first + 1), ptr->slot(index), ptr->slot(first));
+    ptr->set_begin(first - 1);
+    ptr->at(--index) = std::move(tmp);
+  }
+  ++size_;
+
+  return iterator(ptr, index);
+}
+
+// Inserts every argument before pos, keeping their order, and returns an
+// iterator to the first one (pos itself when there are none)
+template <typename T, size_t BlockBytes, typename Allocator>
+template <typename... Args>
+typename UnrolledList<T, BlockBytes, Allocator>::iterator
+UnrolledList<T, BlockBytes, Allocator>::insert_many(const_iterator pos,
+                                                    Args&&... args) {
+  iterator it(pos.get_node(), pos.get_index());
+  if constexpr (sizeof...(Args) > 0) {
+    // Each insert may shift the block, so keep inserting after the newest
+    // element and step back to the first one at the end
+    ((it = insert(pos, std::forward<Args>(args)), pos = std::next(it)), ...);
+    for (size_t i = 1; i < sizeof...(Args); ++i) {
+      --it;
+    }
+  }
+
+  return it;
+}
+
+template <typename T, size_t BlockBytes, typename Allocator>
+template <typename... Args>
+void UnrolledList<T, BlockBytes, Allocator>::insert_many_back(
+    Args&&... args) {
+  (push_back(std::forward<Args>(args)), ...);
+}
+
+// Each argument goes to the front in turn, so the last one ends up first
+template <typename T, size_t BlockBytes, typename Allocator>
+template <typename... Args>
+void UnrolledList<T, BlockBytes, Allocator>::insert_many_front(
+    Args&&... args) {
+  (push_front(std::forward<Args>(args)), ...);
+}
+
+// Closes the gap from whichever end of the block is nearer
+template <typename T, size_t BlockBytes, typename Allocator>
+typename UnrolledList<T, BlockBytes, Allocator>::iterator
+UnrolledList<T, BlockBytes, Allocator>::erase(const_iterator pos) {
+  block* ptr = as_block(pos.get_node());
+  size_t index = pos.get_index();
+  size_t first = ptr->begin_index();
+  size_t last = ptr->end_index();
+  if (index - first < last - 1 - index) {
+    std::move_backward(ptr->slot(first), ptr->slot(index),
+                       ptr->slot(index + 1));
+    std::destroy_at(ptr->slot(first));
+    ptr->set_begin(first + 1);
+    ++index;
+  } else {
+    std::move(ptr->slot(index + 1), ptr->slot(last), ptr->slot(index));
+    std::destroy_at(ptr->slot(last - 1));
+    ptr->set_end(last - 1);
+  }
+  --size_;
+
+  if (index == ptr->end_index()) {
+    ListNodeBase* next = ptr->next();
+    if (ptr->empty()) {
+      destroy_block(ptr);
+    }
+    return iterator(next, header(next)->begin_index());
+  }
+
+  return iterator(ptr, index);
+}
+
+template <typename T, size_t BlockBytes, typename Allocator>
+void UnrolledList<T, BlockBytes, Allocator>::swap(
+    UnrolledList& other) noexcept {
+  if (this == &other) {
+    return;
+  }
+
+  ListNodeBase* first = sentinel_.next();
+  ListNodeBase* last = sentinel_.prev();
+  std::swap(size_, other.size_);
+  pool_.swap(other.pool_);
+  attach(other.sentinel_.next(), other.sentinel_.prev());
+  other.attach(first, last);
+}
+
+template <typename T, size_t BlockBytes, typename Allocator>
+void UnrolledList<T, BlockBytes, Allocator>::splice(const_iterator pos,
+                                                    UnrolledList& other) {
+  if (this == &other || other.empty()) {
+    return;
+  }
+
+  ListNodeBase* next = pos.get_node();
+  if (next != &sentinel_ && pos.get_index() != header(next)->begin_index()) {
+    next = split(as_block(next), pos.get_index());
+  }
+  pool_.adopt(other.pool_);
+
+  ListNodeBase* first = other.sentinel_.next();
+  ListNodeBase* last = other.sentinel_.prev();
+  ListNodeBase* prev = next->prev();
+  prev->set_next(first);
+  first->set_prev(prev);
+  last->set_next(next);
+  next->set_prev(last);
+
+  size_ += other.size_;
+  other.size_ = 0;
+  other.attach(nullptr, nullptr);
+}
+
+}  // namespace s21
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+#include "s21_list_node.h"
+
+namespace s21 {
+
+// Links plus the occupied window [begin, end) of a block. The list's
+// sentinel is a bare header whose window is empty at index 0.
+class UnrolledListBlockBase : public ListNodeBase {
+ public:
+  explicit UnrolledListBlockBase(size_t start = 0) noexcept
+      : begin_(uint32_t(start)), end_(uint32_t(start)) {}
+
+  size_t begin_index() const noexcept { return begin_; }
+  size_t end_index() const noexcept { return end_; }
+  size_t size() const noexcept { return end_ - begin_; }
+  bool empty() const noexcept { return begin_ == end_; }
+  void set_begin(size_t index) noexcept { begin_ = uint32_t(index); }
+  void set_end(size_t index) noexcept { end_ = uint32_t(index); }
+
+ private:
+  uint32_t begin_;
+  uint32_t end_;
+};
+
+// Raw storage for Capacity elements. Only slots inside the window hold
+// live objects; the list constructs and destroys them.
+template <typename T, size_t Capacity>
+class UnrolledListBlock : public UnrolledListBlockBase {
+ public:
+  using value_type = T;
+  static constexpr size_t kCapacity = Capacity;
+
+  explicit UnrolledListBlock(size_t start) noexcept
+      : UnrolledListBlockBase(start) {}
+  ~UnrolledListBlock() = default;
+
+  T* slot(size_t index) noexcept {
+    return std::launder(reinterpret_cast<T*>(storage_)) + index;
+  }
+  T& at(size_t index) noexcept { return *slot(index); }
+
+  bool full() const noexcept {
+    return !begin_index() && end_index() == Capacity;
+  }
+
+ private:
+  alignas(T) unsigned char storage_[sizeof(T) * Capacity];
+};
+
+}  // namespace s21
@@ -0,0 +1,153 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include "s21_unrolled_list_block.h"
+
+namespace s21 {
+
+template <typename T, size_t BlockBytes, typename Allocator>
+class UnrolledList;
+
+// A block and a slot index inside it. end() is the sentinel at index 0.
+template <typename Block, typename T>
+class BaseUnrolledListIterator {
+ public:
+  using value_type = std::remove_const_t<T>;
+  using reference = T&;
+  using pointer = T*;
+  using difference_type = std::ptrdiff_t;
+  using iterator_category = std::bidirectional_iterator_tag;
+
+  BaseUnrolledListIterator() = default;
+
+  ListNodeBase* get_node() const noexcept { return node_; }
+  size_t get_index() const noexcept { return index_; }
+
+  reference operator*() const {
+    return static_cast<Block*>(node_)->at(index_);
+  }
+  pointer operator->() const { return &**this; }
+
+ protected:
+  BaseUnrolledListIterator(ListNodeBase* node, size_t index) noexcept
+      : node_(node), index_(index) {}
+
+  static const UnrolledListBlockBase* header(ListNodeBase* node) noexcept {
+    return static_cast<const UnrolledListBlockBase*>(node);
+  }
+
+  void next() noexcept {
+    if (++index_ == header(node_)->end_index()) {
+      node_ = node_->next();
+      index_ = header(node_)->begin_index();
+    }
+  }
+
+  void prev() noexcept {
+    if (index_ == header(node_)->begin_index()) {
+      node_ = node_->prev();
+      index_ = header(node_)->end_index();
+    }
+    --index_;
+  }
+
+  bool equals(const BaseUnrolledListIterator& other) const noexcept {
+    return node_ == other.node_ && index_ == other.index_;
+  }
+
+  ListNodeBase* node_{};
+  size_t index_{};
+};
+
+template <typename Block>
+class UnrolledListIterator
+    : public BaseUnrolledListIterator<Block, typename Block::value_type> {
+ public:
+  template <typename, size_t, typename>
+  friend class UnrolledList;
+  using base = BaseUnrolledListIterator<Block, typename Block::value_type>;
+
+  UnrolledListIterator() = default;
+
+  UnrolledListIterator& operator++() {
+    this->next();
+    return *this;
+  }
+  UnrolledListIterator operator++(int) {
+    auto tmp{*this};
+    this->next();
+    return tmp;
+  }
+  UnrolledListIterator& operator--() {
+    this->prev();
+    return *this;
+  }
+  UnrolledListIterator operator--(int) {
+    auto tmp{*this};
+    this->prev();
+    return tmp;
+  }
+
+  friend bool operator==(const UnrolledListIterator& a,
+                         const UnrolledListIterator& b) {
+    return a.equals(b);
+  }
+  friend bool operator!=(const UnrolledListIterator& a,
+                         const UnrolledListIterator& b) {
+    return !(a == b);
+  }
+
+ protected:
+  using base::base;
+};
+
+template <typename Block>
+class ConstUnrolledListIterator
+    : public BaseUnrolledListIterator<Block,
+                                      const typename Block::value_type> {
+ public:
+  template <typename, size_t, typename>
+  friend class UnrolledList;
+  using base =
+      BaseUnrolledListIterator<Block, const typename Block::value_type>;
+
+  ConstUnrolledListIterator() = default;
+  ConstUnrolledListIterator(const UnrolledListIterator<Block>& other) noexcept
+      : base(other.get_node(), other.get_index()) {}
+
+  ConstUnrolledListIterator& operator++() {
+    this->next();
+    return *this;
+  }
+  ConstUnrolledListIterator operator++(int) {
+    auto tmp{*this};
+    this->next();
+    return tmp;
+  }
+  ConstUnrolledListIterator& operator--() {
+    this->prev();
+    return *this;
+  }
+  ConstUnrolledListIterator operator--(int) {
+    auto tmp{*this};
+    this->prev();
+    return tmp;
+  }
+
+  friend bool operator==(const ConstUnrolledListIterator& a,
+                         const ConstUnrolledListIterator& b) {
+    return a.equals(b);
+  }
+  friend bool operator!=(const ConstUnrolledListIterator& a,
+                         const ConstUnrolledListIterator& b) {
+    return !(a == b);
+  }
+
+ protected:
+  using base::base;
+};
+
+}  // namespace s21
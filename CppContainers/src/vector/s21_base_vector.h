@@ -0,0 +1,836 @@
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
+#include "s21_trivial_fill.h"
+#include "s21_vector_config.h"
+#include "s21_vector_growth.h"
+#include "s21_vector_iterator.h"
+
+namespace s21 {
+
+// Room for N elements inside the object. The N = 0 case takes no space and
+// has no inline slots, so its inline_data() is null.
+template <typename T, size_t N>
+class InlineBuffer {
+ protected:
+  T* inline_data() noexcept { return reinterpret_cast<T*>(storage_); }
+  const T* inline_data() const noexcept {
+    return reinterpret_cast<const T*>(storage_);
+  }
+
+ private:
+  alignas(T) unsigned char storage_[N * sizeof(T)];
+};
+
+template <typename T>
+class InlineBuffer<T, 0> {
+ protected:
+  T* inline_data() noexcept { return nullptr; }
+  const T* inline_data() const noexcept { return nullptr; }
+};
+
+// Storage and algorithms shared by Vector and SmallVector. The elements
+// live in the N inline slots while they fit and in a heap buffer from
+// Allocator once they don't; Vector is the N = 0 case, which always uses
+// the heap.
+template <typename T, size_t N, typename Allocator, typename Growth>
+class BaseVector : private InlineBuffer<T, N> {
+  using alloc_traits = std::allocator_traits<Allocator>;
+
+ public:
+  using value_type = T;
+  using allocator_type = Allocator;
+  using growth_policy = Growth;
+  using reference = T&;
+  using const_reference = const T&;
+  using pointer = typename alloc_traits::pointer;
+  using size_type = size_t;
+#if S21_CHECKED_ITERATORS
+  using iterator = VectorIterator<T>;
+  using const_iterator = ConstVectorIterator<T>;
+#else
+  using iterator = T*;
+  using const_iterator = const T*;
+#endif
+
+  BaseVector() = default;
+  explicit BaseVector(const allocator_type& alloc) : alloc_(alloc) {}
+  explicit BaseVector(size_type count, const_reference value = {},
+                      const allocator_type& alloc = allocator_type());
+  BaseVector(std::initializer_list<T> const& items,
+             const allocator_type& alloc = allocator_type());
+  BaseVector(const BaseVector& other);
+  BaseVector(BaseVector&& other) noexcept(
+      !N || std::is_nothrow_move_constructible_v<T>);
+  ~BaseVector();
+
+  BaseVector& operator=(const BaseVector& other);
+  BaseVector& operator=(BaseVector&& other) noexcept(
+      !N || std::is_nothrow_move_constructible_v<T>);
+  reference operator[](size_type pos);
+  const_reference operator[](size_type pos) const;
+
+  const_reference front() const;
+  const_reference back() const;
+  T* data() noexcept { return data_; }
+  const T* data() const noexcept { return data_; }
+  allocator_type get_allocator() const noexcept { return alloc_; }
+
+  iterator begin() { return make_iterator<iterator>(data_, size_, 0); }
+  iterator end() { return make_iterator<iterator>(data_, size_, size_); }
+  const_iterator begin() const {
+    return make_iterator<const_iterator>(data_, size_, 0);
+  }
+  const_iterator end() const {
+    return make_iterator<const_iterator>(data_, size_, size_);
+  }
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+  size_type max_size() const noexcept {
+    return alloc_traits::max_size(alloc_);
+  }
+  void reserve(size_type new_cap);
+  size_type capacity() const noexcept { return capacity_; }
+  void shrink_to_fit();
+
+  reference at(const size_type pos);
+  const_reference at(const size_type pos) const;
+  void set_element(size_type pos, const_reference value);
+  void push_back(const_reference value);
+  void push_back(T&& value);
+  template <typename... Args>
+  reference emplace_back(Args&&... args);
+  void clear();
+
+  iterator insert(iterator pos, const_reference value);
+  iterator insert(iterator pos, T&& value);
+  template <typename InputIt,
+            typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+  iterator insert(iterator pos, InputIt first, InputIt last);
+  template <typename... Args>
+  iterator emplace(iterator pos, Args&&... args);
+  template <typename... Args>
+  iterator insert_many(iterator pos, Args&&... args);
+  template <typename... Args>
+  void insert_many_back(Args&&... args);
+
+  iterator erase(iterator pos);
+  iterator erase(iterator first, iterator last);
+  void pop_back();
+  void swap(BaseVector& other);
+
+ protected:
+  bool is_inline() const noexcept { return data_ == this->inline_data(); }
+  pointer allocate_vector(size_type size);
+  void deallocate_vector(pointer ptr, size_type size) noexcept;
+  template <typename... Args>
+  void construct_at(pointer ptr, Args&&... args);
+  template <typename... Args>
+  void construct_each(pointer dest, Args&&... args);
+  void destroy_range(pointer first, pointer last) noexcept;
+  template <typename InputIt>
+  void construct_range(pointer dest, InputIt first, InputIt last);
+  void transfer_range(pointer first, pointer last, pointer dest);
+  void release_heap() noexcept;
+  void steal(BaseVector& other);
+  size_type next_capacity(size_type required) const;
+  template <typename Construct>
+  void reallocate_with(size_type new_cap, size_type index, size_type count,
+                       Construct construct);
+  void reallocate(size_type new_cap);
+  void shift_tail(size_type index, size_type count);
+  template <typename U>
+  void place_at(size_type index, size_type old_size, U&& value);
+  // Shifts the tail and fills the count-slot gap at index from first
+  template <typename It>
+  void fill_gap(size_type index, size_type count, It first);
+  // Whether [first, last) reads elements of this vector, judged by its
+  // first element
+  template <typename It>
+  bool overlaps(It first, It last) const;
+  template <typename It, typename Ptr>
+  static It make_iterator(Ptr base, size_type size, size_type index);
+
+  // Types that can be moved to a new buffer with a plain byte copy, skipping
+  // the per-element move and destroy
+  static constexpr bool trivially_relocatable =
+      std::is_trivially_copyable_v<T>;
+
+ private:
+  pointer data_{this->inline_data()};
+  size_type size_{0};
+  size_type capacity_{N};
+  allocator_type alloc_{};
+};
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+typename BaseVector<T, N, Allocator, Growth>::pointer
+BaseVector<T, N, Allocator, Growth>::allocate_vector(size_type size) {
+  if (!size) {
+    return nullptr;
+  }
+  try {
+    return alloc_traits::allocate(alloc_, size);
+  } catch (std::bad_alloc& e) {
+    throw std::runtime_error("Error: Failed to allocate memory");
+  }
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+void BaseVector<T, N, Allocator, Growth>::deallocate_vector(
+    pointer ptr, size_type size) noexcept {
+  if (ptr) {
+    alloc_traits::deallocate(alloc_, ptr, size);
+  }
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+template <typename... Args>
+void BaseVector<T, N, Allocator, Growth>::construct_at(pointer ptr,
+                                                       Args&&... args) {
+  alloc_traits::construct(alloc_, ptr, std::forward<Args>(args)...);
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+template <typename... Args>
+void BaseVector<T, N, Allocator, Growth>::construct_each(pointer dest,
+                                                         Args&&... args) {
+  pointer current = dest;
+  try {
+    ((construct_at(current, std::forward<Args>(args)), ++current), ...);
+  } catch (...) {
+    destroy_range(dest, current);
+    throw;
+  }
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+void BaseVector<T, N, Allocator, Growth>::destroy_range(
+    pointer first, pointer last) noexcept {
+  for (; first != last; ++first) {
+    alloc_traits::destroy(alloc_, first);
+  }
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+template <typename InputIt>
+void BaseVector<T, N, Allocator, Growth>::construct_range(pointer dest,
+                                                          InputIt first,
+                                                          InputIt last) {
+  using source_type = std::remove_cv_t<std::remove_pointer_t<InputIt>>;
+  if constexpr (trivially_relocatable && std::is_pointer_v<InputIt> &&
+                std::is_same_v<source_type, T>) {
+    if (first != last) {
+      std::memcpy(static_cast<void*>(dest), first, (last - first) * sizeof(T));
+    }
+  } else {
+    pointer current = dest;
+    try {
+      for (; first != last; ++first, ++current) {
+        construct_at(current, *first);
+      }
+    } catch (...) {
+      destroy_range(dest, current);
+      throw;
+    }
+  }
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+void BaseVector<T, N, Allocator, Growth>::transfer_range(pointer first,
+                                                         pointer last,
+                                                         pointer dest) {
+  if constexpr (trivially_relocatable) {
+    if (first != last) {
+      std::memcpy(static_cast<void*>(dest), first, (last - first) * sizeof(T));
+    }
+  } else {
+    pointer current = dest;
+    try {
+      for (; first != last; ++first, ++current) {
+        construct_at(current, std::move_if_noexcept(*first));
+      }
+    } catch (...) {
+      destroy_range(dest, current);
+      throw;
+    }
+  }
+}
+
+// Gives the heap buffer back and points the vector at its inline slots.
+// Elements must already be destroyed or moved out.
+template <typename T, size_t N, typename Allocator, typename Growth>
+void BaseVector<T, N, Allocator, Growth>::release_heap() noexcept {
+  if (!is_inline()) {
+    deallocate_vector(data_, capacity_);
+    data_ = this->inline_data();
+    capacity_ = N;
+  }
+}
+
+// Takes over other's elements, leaving it empty. A heap buffer changes
+// hands as is; inline elements have to be moved one by one.
+template <typename T, size_t N, typename Allocator, typename Growth>
+void BaseVector<T, N, Allocator, Growth>::steal(BaseVector& other) {
+  // Without inline slots an empty vector's null buffer is handed over too
+  if constexpr (N > 0) {
+    if (other.is_inline()) {
+      transfer_range(other.data_, other.data_ + other.size_, data_);
+      size_ = other.size_;
+      other.clear();
+      return;
+    }
+  }
+
+  data_ = other.data_;
+  size_ = other.size_;
+  capacity_ = other.capacity_;
+  other.data_ = other.inline_data();
+  other.size_ = 0;
+  other.capacity_ = N;
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+typename BaseVector<T, N, Allocator, Growth>::size_type
+BaseVector<T, N, Allocator, Growth>::next_capacity(size_type required) const {
+  if (required > max_size()) {
+    throw std::length_error("Error: Requested capacity exceeds max_size");
+  }
+  size_type new_cap = Growth::next_capacity(capacity_, required);
+
+  return new_cap > max_size() ? max_size() : new_cap;
+}
+
+// Moves the elements into a new buffer of new_cap elements, leaving a gap of
+// count slots at index that construct fills in. The new elements are built
+// before anything is relocated, so arguments that refer to elements of this
+// vector stay valid. A new_cap that fits into the inline slots moves the
+// elements back into the object.
+template <typename T, size_t N, typename Allocator, typename Growth>
+template <typename Construct>
+void BaseVector<T, N, Allocator, Growth>::reallocate_with(size_type new_cap,
+                                                          size_type index,
+                                                          size_type count,
+                                                          Construct construct) {
+  bool to_inline = N && new_cap <= N && !is_inline();
+  pointer buffer{};
+  if (to_inline) {
+    buffer = this->inline_data();
+    new_cap = N;
+  } else {
+    buffer = allocate_vector(new_cap);
+  }
+
+  int stage = 0;
+  try {
+    construct(buffer + index);
+    ++stage;
+    transfer_range(data_, data_ + index, buffer);
+    ++stage;
+    transfer_range(data_ + index, data_ + size_, buffer + index + count);
+  } catch (...) {
+    if (stage > 1) destroy_range(buffer, buffer + index);
+    if (stage > 0) destroy_range(buffer + index, buffer + index + count);
+    if (!to_inline) deallocate_vector(buffer, new_cap);
+    throw;
+  }
+
+  destroy_range(data_, data_ + size_);
+  release_heap();
+  data_ = buffer;
+  capacity_ = new_cap;
+  size_ += count;
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+void BaseVector<T, N, Allocator, Growth>::reallocate(size_type new_cap) {
+  reallocate_with(new_cap, size_, 0, [](pointer) {});
+}
+
+// Opens a gap of count slots at index by moving [index, size()) up in one
+// pass; capacity must already allow it. Gap slots below the old size are left
+// holding moved-from elements, the ones past it hold no object.
+template <typename T, size_t N, typename Allocator, typename Growth>
+void BaseVector<T, N, Allocator, Growth>::shift_tail(size_type index,
+                                                     size_type count) {
+  if (!count || index == size_) {
+    return;
+  }
+  if constexpr (trivially_relocatable) {
+    std::memmove(static_cast<void*>(data_ + index + count), data_ + index,
+                 (size_ - index) * sizeof(T));
+  } else {
+    size_type split = size_ - std::min(count, size_ - index);
+    pointer dest = data_ + split + count;
+    for (pointer it = data_ + split; it != data_ + size_; ++it, ++dest) {
+      construct_at(dest, std::move(*it));
+    }
+    std::move_backward(data_ + index, data_ + split, data_ + split + count);
+  }
+}
+
+// Fills gap slot index after shift_tail: slots below old_size hold a
+// moved-from element to assign to, the others raw memory to construct in
+template <typename T, size_t N, typename Allocator, typename Growth>
+template <typename U>
+void BaseVector<T, N, Allocator, Growth>::place_at(size_type index,
+                                                   size_type old_size,
+                                                   U&& value) {
+  if (trivially_relocatable || index >= old_size) {
+    construct_at(data_ + index, std::forward<U>(value));
+  } else {
+    data_[index] = std::forward<U>(value);
+  }
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+template <typename It>
+void BaseVector<T, N, Allocator, Growth>::fill_gap(size_type index,
+                                                   size_type count, It first) {
+  size_type old_size = size_;
+  shift_tail(index, count);
+  for (size_type i = 0; i < count; ++i, ++first) {
+    place_at(index + i, old_size, *first);
+  }
+  size_ += count;
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+template <typename It>
+bool BaseVector<T, N, Allocator, Growth>::overlaps(It first, It last) const {
+  using reference = typename std::iterator_traits<It>::reference;
+  if constexpr (std::is_reference_v<reference> &&
+                std::is_same_v<std::remove_cv_t<std::remove_reference_t<
+                                   reference>>,
+                               T>) {
+    if (first != last) {
+      const T& item = *first;
+      std::less<const T*> less;
+      return !less(std::addressof(item), data_) &&
+             less(std::addressof(item), data_ + size_);
+    }
+  }
+
+  return false;
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+template <typename It, typename Ptr>
+It BaseVector<T, N, Allocator, Growth>::make_iterator(Ptr base,
+                                                      size_type size,
+                                                      size_type index) {
+  if constexpr (std::is_pointer_v<It>) {
+    return base + index;
+  } else {
+    return It(base, size) + index;
+  }
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+BaseVector<T, N, Allocator, Growth>::BaseVector(size_type count,
+                                                const_reference value,
+                                                const allocator_type& alloc)
+    : alloc_(alloc) {
+  reserve(count);
+  if constexpr (trivially_relocatable) {
+    fill_trivial(data_, count, value);
+    size_ = count;
+    return;
+  }
+  try {
+    for (; size_ < count; ++size_) {
+      construct_at(data_ + size_, value);
+    }
+  } catch (...) {
+    clear();
+    release_heap();
+    throw;
+  }
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+BaseVector<T, N, Allocator, Growth>::BaseVector(
+    std::initializer_list<T> const& items, const allocator_type& alloc)
+    : alloc_(alloc) {
+  reserve(items.size());
+  try {
+    construct_range(data_, items.begin(), items.end());
+  } catch (...) {
+    release_heap();
+    throw;
+  }
+  size_ = items.size();
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+BaseVector<T, N, Allocator, Growth>::BaseVector(const BaseVector& other)
+    : alloc_(
+          alloc_traits::select_on_container_copy_construction(other.alloc_)) {
+  reserve(other.size_);
+  try {
+    construct_range(data_, other.data_, other.data_ + other.size_);
+  } catch (...) {
+    release_heap();
+    throw;
+  }
+  size_ = other.size_;
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+BaseVector<T, N, Allocator, Growth>::BaseVector(BaseVector&& other) noexcept(
+    !N || std::is_nothrow_move_constructible_v<T>)
+    : alloc_(std::move(other.alloc_)) {
+  steal(other);
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+BaseVector<T, N, Allocator, Growth>::~BaseVector() {
+  clear();
+  release_heap();
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+BaseVector<T, N, Allocator, Growth>&
+BaseVector<T, N, Allocator, Growth>::operator=(const BaseVector& other) {
+  if (this != &other) {
+    BaseVector tmp(other);
+    *this = std::move(tmp);
+  }
+
+  return *this;
+}
+
+// Heap-only vectors hand their buffer over by swapping, so other gets the old
+// elements; with inline slots they are destroyed and other is left empty
+template <typename T, size_t N, typename Allocator, typename Growth>
+BaseVector<T, N, Allocator, Growth>&
+BaseVector<T, N, Allocator, Growth>::operator=(BaseVector&& other) noexcept(
+    !N || std::is_nothrow_move_constructible_v<T>) {
+  if constexpr (!N) {
+    swap(other);
+  } else if (this != &other) {
+    clear();
+    release_heap();
+    steal(other);
+  }
+
+  return *this;
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+void BaseVector<T, N, Allocator, Growth>::reserve(size_type new_cap) {
+  if (new_cap > max_size()) {
+    throw std::length_error("Error: Requested capacity exceeds max_size");
+  }
+  if (new_cap > capacity_) {
+    reallocate(new_cap);
+  }
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+void BaseVector<T, N, Allocator, Growth>::shrink_to_fit() {
+  if (!is_inline() && size_ < capacity_) {
+    reallocate(size_);
+  }
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+typename BaseVector<T, N, Allocator, Growth>::reference
+BaseVector<T, N, Allocator, Growth>::at(const size_type pos) {
+  if (pos >= size_) {
+    throw std::out_of_range("Error: Attempt to access beyond the vector");
+  }
+
+  return data_[pos];
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+typename BaseVector<T, N, Allocator, Growth>::const_reference
+BaseVector<T, N, Allocator, Growth>::at(const size_type pos) const {
+  if (pos >= size_) {
+    throw std::out_of_range("Error: Attempt to access beyond the vector");
+  }
+
+  return data_[pos];
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+typename BaseVector<T, N, Allocator, Growth>::reference
+BaseVector<T, N, Allocator, Growth>::operator[](size_type pos) {
+#if S21_HARDENED
+  return at(pos);
+#else
+  return data_[pos];
+#endif
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+typename BaseVector<T, N, Allocator, Growth>::const_reference
+BaseVector<T, N, Allocator, Growth>::operator[](size_type pos) const {
+#if S21_HARDENED
+  return at(pos);
+#else
+  return data_[pos];
+#endif
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+typename BaseVector<T, N, Allocator, Growth>::const_reference
+BaseVector<T, N, Allocator, Growth>::front() const {
+  return at(0);
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+typename BaseVector<T, N, Allocator, Growth>::const_reference
+BaseVector<T, N, Allocator, Growth>::back() const {
+  return at(size_ - 1);
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+void BaseVector<T, N, Allocator, Growth>::set_element(size_type pos,
+                                                      const_reference value) {
+  at(pos) = value;
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+void BaseVector<T, N, Allocator, Growth>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+void BaseVector<T, N, Allocator, Growth>::push_back(T&& value) {
+  emplace_back(std::move(value));
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+template <typename... Args>
+typename BaseVector<T, N, Allocator, Growth>::reference
+BaseVector<T, N, Allocator, Growth>::emplace_back(Args&&... args) {
+  if (size_ == capacity_) {
+    reallocate_with(next_capacity(size_ + 1), size_, 1, [&](pointer dest) {
+      construct_at(dest, std::forward<Args>(args)...);
+    });
+  } else {
+    construct_at(data_ + size_, std::forward<Args>(args)...);
+    ++size_;
+  }
+
+  return data_[size_ - 1];
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+void BaseVector<T, N, Allocator, Growth>::clear() {
+  destroy_range(data_, data_ + size_);
+  size_ = 0;
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+typename BaseVector<T, N, Allocator, Growth>::iterator
+BaseVector<T, N, Allocator, Growth>::insert(iterator pos,
+                                            const_reference value) {
+  return insert_many(pos, value);
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+typename BaseVector<T, N, Allocator, Growth>::iterator
+BaseVector<T, N, Allocator, Growth>::insert(iterator pos, T&& value) {
+  return insert_many(pos, std::move(value));
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+template <typename InputIt, typename>
+typename BaseVector<T, N, Allocator, Growth>::iterator
+BaseVector<T, N, Allocator, Growth>::insert(iterator pos, InputIt first,
+                                            InputIt last) {
+  using category = typename std::iterator_traits<InputIt>::iterator_category;
+  size_t posIndex = std::distance(begin(), pos);
+
+  if constexpr (std::is_base_of_v<std::forward_iterator_tag, category>) {
+    size_t count = std::distance(first, last);
+    if (size_ + count > capacity_) {
+      reallocate_with(
+          next_capacity(size_ + count), posIndex, count,
+          [&](pointer dest) { construct_range(dest, first, last); });
+      return begin() + posIndex;
+    }
+
+    // Copying straight into the gap is only safe when no copy can throw
+    // once the tail has moved past size(). A range over this vector's own
+    // elements would also be overwritten by the shift before it is read.
+    // Anything else is copied out below first.
+    using reference = typename std::iterator_traits<InputIt>::reference;
+    if constexpr (std::is_nothrow_constructible_v<T, reference> &&
+                  std::is_nothrow_assignable_v<T&, reference>) {
+      if (!overlaps(first, last)) {
+        fill_gap(posIndex, count, first);
+        return begin() + posIndex;
+      }
+    }
+  }
+
+  BaseVector items;
+  for (; first != last; ++first) {
+    items.emplace_back(*first);
+  }
+  auto moved = std::make_move_iterator(items.data_);
+  if (size_ + items.size_ > capacity_) {
+    reallocate_with(next_capacity(size_ + items.size_), posIndex, items.size_,
+                    [&](pointer dest) {
+                      construct_range(dest, moved, moved + items.size_);
+                    });
+  } else {
+    fill_gap(posIndex, items.size_, moved);
+  }
+
+  return begin() + posIndex;
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+template <typename... Args>
+typename BaseVector<T, N, Allocator, Growth>::iterator
+BaseVector<T, N, Allocator, Growth>::emplace(iterator pos, Args&&... args) {
+  size_t posIndex = std::distance(begin(), pos);
+  if (posIndex == size_) {
+    emplace_back(std::forward<Args>(args)...);
+    return begin() + posIndex;
+  }
+
+  value_type value(std::forward<Args>(args)...);
+  return insert_many(pos, std::move(value));
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+template <typename... Args>
+typename BaseVector<T, N, Allocator, Growth>::iterator
+BaseVector<T, N, Allocator, Growth>::insert_many(iterator pos,
+                                                 Args&&... args) {
+  size_t posIndex = std::distance(begin(), pos);
+  size_t numArgs = sizeof...(args);
+
+  if (size_ + numArgs > capacity_) {
+    reallocate_with(next_capacity(size_ + numArgs), posIndex, numArgs,
+                    [&](pointer dest) {
+                      construct_each(dest, std::forward<Args>(args)...);
+                    });
+    return begin() + posIndex;
+  }
+
+  if constexpr (sizeof...(args) > 0) {
+    // Build the new elements before the tail moves, so arguments that
+    // refer to elements of this vector are read while still in place
+    alignas(T) unsigned char staging[sizeof(T) * sizeof...(args)];
+    pointer items = reinterpret_cast<pointer>(staging);
+    construct_each(items, std::forward<Args>(args)...);
+    try {
+      fill_gap(posIndex, numArgs, std::make_move_iterator(items));
+    } catch (...) {
+      destroy_range(items, items + numArgs);
+      throw;
+    }
+    destroy_range(items, items + numArgs);
+  }
+
+  return begin() + posIndex;
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+template <typename... Args>
+void BaseVector<T, N, Allocator, Growth>::insert_many_back(Args&&... args) {
+  constexpr size_type count = sizeof...(args);
+
+  if (size_ + count > capacity_) {
+    reallocate_with(next_capacity(size_ + count), size_, count,
+                    [&](pointer dest) {
+                      construct_each(dest, std::forward<Args>(args)...);
+                    });
+  } else {
+    construct_each(data_ + size_, std::forward<Args>(args)...);
+    size_ += count;
+  }
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+typename BaseVector<T, N, Allocator, Growth>::iterator
+BaseVector<T, N, Allocator, Growth>::erase(iterator pos) {
+  size_t posIndex = std::distance(begin(), pos);
+#if S21_HARDENED
+  if (posIndex >= size_) {
+    throw std::out_of_range("Error: Attempt to erase beyond the vector");
+  }
+#endif
+  iterator first = begin() + posIndex;
+  iterator last = begin() + (posIndex + 1);
+
+  return erase(first, last);
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+typename BaseVector<T, N, Allocator, Growth>::iterator
+BaseVector<T, N, Allocator, Growth>::erase(iterator first, iterator last) {
+  size_t from = std::distance(begin(), first);
+  size_t to = std::distance(begin(), last);
+  // [first, last) must lie within [begin(), end()]; only hardened builds
+  // check it, as with operator[]
+#if S21_HARDENED
+  if (from > to || to > size_) {
+    throw std::out_of_range("Error: Attempt to erase beyond the vector");
+  }
+#endif
+  if (from >= to) {
+    return begin() + from;
+  }
+
+  if constexpr (trivially_relocatable) {
+    std::memmove(static_cast<void*>(data_ + from), data_ + to,
+                 (size_ - to) * sizeof(T));
+  } else {
+    std::move(data_ + to, data_ + size_, data_ + from);
+    destroy_range(data_ + size_ - (to - from), data_ + size_);
+  }
+  size_ -= to - from;
+
+  return begin() + from;
+}
+
+template <typename T, size_t N, typename Allocator, typename Growth>
+void BaseVector<T, N, Allocator, Growth>::pop_back() {
+  if (size_ > 0) {
+    --size_;
+    alloc_traits::destroy(alloc_, data_ + size_);
+  }
+}
+
+// Two heap buffers just trade places; inline elements can't, so a swap
+// involving one moves the elements instead
+template <typename T, size_t N, typename Allocator, typename Growth>
+void BaseVector<T, N, Allocator, Growth>::swap(BaseVector& other) {
+  if (this == &other) {
+    return;
+  }
+  if (!N || (!is_inline() && !other.is_inline())) {
+    std::swap(data_, other.data_);
+    std::swap(size_, other.size_);
+    std::swap(capacity_, other.capacity_);
+    if constexpr (alloc_traits::propagate_on_container_swap::value) {
+      std::swap(alloc_, other.alloc_);
+    }
+    return;
+  }
+
+  BaseVector tmp(std::move(other));
+  other = std::move(*this);
+  *this = std::move(tmp);
+}
+
+}  // namespace s21
@@ -1,6 +1,8 @@
 #pragma once
 
-#include <memory>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
 
 namespace s21 {
 
@@ -14,27 +16,17 @@ class BaseArrayIterator {
   using iterator_category = std::random_access_iterator_tag;
 
   BaseArrayIterator() = default;
-  BaseArrayIterator(std::shared_ptr<value_type[]> ptr, size_t size)
-      : ptr_(ptr), size_(size){};
+  BaseArrayIterator(pointer ptr, size_t size) : ptr_(ptr), size_(size){};
   virtual ~BaseArrayIterator() = default;
 
   reference operator*() const noexcept {
-    return *(this->get_shared().get() + this->index_);
+    return *(this->ptr_ + this->index_);
   }
 
-  pointer operator->() const noexcept {
-    return this->get_shared().get() + this->index_;
-  }
+  pointer operator->() const noexcept { return this->ptr_ + this->index_; }
 
  protected:
-  std::shared_ptr<value_type[]> get_shared() const {
-    try {
-      return ptr_.lock();
-    } catch (std::bad_weak_ptr &e) {
-      throw std::runtime_error(
-          "Error: Attempted to access an expired weak pointer");
-    }
-  }
+  pointer get_base() const noexcept { return ptr_; }
   void forward(int step = 1) {
     if (index_ + step > size_) {
       throw std::out_of_range("Error: Step goes beyond vector size");
@@ -49,7 +41,7 @@ class BaseArrayIterator {
   }
 
  protected:
-  std::weak_ptr<value_type[]> ptr_;
+  pointer ptr_{};
   size_t index_{0};
   size_t size_{0};
 };
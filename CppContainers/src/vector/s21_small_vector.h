@@ -0,0 +1,29 @@
+#pragma once
+
+#include <memory>
+
+#include "s21_base_vector.h"
+#include "s21_vector_growth.h"
+
+namespace s21 {
+
+// Vector with room for N elements inside the object itself. Nothing is
+// allocated until the N + 1st element arrives; from then on the elements live
+// on the heap exactly as in s21::Vector. The API matches s21::Vector, and
+// both share their code through BaseVector.
+template <typename T, size_t N, typename Allocator = std::allocator<T>,
+          typename Growth = DoublingGrowth>
+class SmallVector : public BaseVector<T, N, Allocator, Growth> {
+  static_assert(N > 0, "SmallVector needs room for at least one element");
+  using base = BaseVector<T, N, Allocator, Growth>;
+
+ public:
+  using typename base::size_type;
+
+  using base::base;
+
+  static constexpr size_type inline_capacity() noexcept { return N; }
+  using base::is_inline;
+};
+
+}  // namespace s21
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+
+namespace s21 {
+
+// True when every byte of value's object representation is the same, so a
+// run of copies of it can be written with memset
+template <typename T>
+bool has_uniform_bytes(const T& value) noexcept {
+  const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&value);
+  for (size_t i = 1; i < sizeof(T); ++i) {
+    if (bytes[i] != bytes[0]) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// Writes count copies of value starting at dest. dest may hold no objects
+// yet: the type is trivially copyable, so a byte copy creates them.
+template <typename T>
+void fill_trivial(T* dest, size_t count, const T& value) noexcept {
+  static_assert(std::is_trivially_copyable_v<T>);
+  if (!count) {
+    return;
+  }
+  if (has_uniform_bytes(value)) {
+    std::memset(static_cast<void*>(dest),
+                *reinterpret_cast<const unsigned char*>(&value),
+                count * sizeof(T));
+  } else {
+    std::fill_n(dest, count, value);
+  }
+}
+
+}  // namespace s21
@@ -0,0 +1,27 @@
+#pragma once
+
+// S21_CHECKED_ITERATORS selects the Vector iterator type at compile time:
+//   1 - VectorIterator, which validates every step against the vector size
+//   0 - plain pointers into the buffer, the same contiguous iterators
+//       std::vector gives in release builds
+// Defaults to checked iterators unless NDEBUG is defined.
+#ifndef S21_CHECKED_ITERATORS
+#ifdef NDEBUG
+#define S21_CHECKED_ITERATORS 0
+#else
+#define S21_CHECKED_ITERATORS 1
+#endif
+#endif
+
+// S21_HARDENED makes Vector::operator[] and Array::operator[] check the index
+// and throw std::out_of_range like at(), and Vector::erase check that the
+// position or range lies within the vector. Without it operator[] reads the
+// element directly, as with a raw array, and erase trusts its arguments.
+// Defaults to hardened unless NDEBUG is defined.
+#ifndef S21_HARDENED
+#ifdef NDEBUG
+#define S21_HARDENED 0
+#else
+#define S21_HARDENED 1
+#endif
+#endif
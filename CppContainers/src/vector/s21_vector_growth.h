@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstddef>
+
+namespace s21 {
+
+// Growth policies pick the capacity Vector reallocates to once the buffer
+// can't hold `required` elements. Geometric growth keeps the number of
+// reallocations for n appends at O(log n).
+template <size_t Numerator, size_t Denominator>
+struct GeometricGrowth {
+  static_assert(Numerator > Denominator, "Growth factor must exceed 1");
+
+  static size_t next_capacity(size_t capacity, size_t required) noexcept {
+    size_t grown = capacity / Denominator * Numerator +
+                   capacity % Denominator * Numerator / Denominator;
+    if (grown <= capacity) {
+      grown = capacity + 1;
+    }
+
+    return grown < required ? required : grown;
+  }
+};
+
+using DoublingGrowth = GeometricGrowth<2, 1>;
+using OneAndHalfGrowth = GeometricGrowth<3, 2>;
+
+}  // namespace s21
@@ -54,7 +54,7 @@ class VectorIterator : public BaseArrayIterator<T> {
 template <typename T>
 bool VectorIterator<T>::operator==(
     const VectorIterator<T>& other) const noexcept {
-  return this->get_shared().get() == other.get_shared().get() &&
+  return this->get_base() == other.get_base() &&
          this->index_ == other.index_;
 }
 
@@ -146,7 +146,7 @@ bool VectorIterator<T>::operator<=(
 
 template <typename T>
 typename VectorIterator<T>::reference VectorIterator<T>::operator[](int pos) {
-  return *(this->get_shared().get() + pos);
+  return *(this->get_base() + pos);
 }
 
 template <typename T>
@@ -194,7 +194,7 @@ class ConstVectorIterator : public BaseArrayIterator<const T> {
 template <typename T>
 bool ConstVectorIterator<T>::operator==(
     const ConstVectorIterator<T>& other) const noexcept {
-  return this->get_shared().get() == other.get_shared().get() &&
+  return this->get_base() == other.get_base() &&
          this->index_ == other.index_;
 }
 